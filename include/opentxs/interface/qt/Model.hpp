@@ -13,6 +13,7 @@
 #include <QObject>
 #include <QString>
 #include <QVariant>
+#include <QVector>
 #include <memory>
 
 class QByteArray;
@@ -78,10 +79,15 @@ class ModelHelper final : public QObject
 signals:
     void changeRow(ui::internal::Row* parent, ui::internal::Row* row);
     void deleteRow(ui::internal::Row* row);
+    void deleteRows(QVector<ui::internal::Row*> rows);
     void insertRow(
         ui::internal::Row* parent,
         ui::internal::Row* after,
         opentxs::ui::qt::RowWrapper row);
+    void insertRows(
+        ui::internal::Row* parent,
+        ui::internal::Row* after,
+        QVector<opentxs::ui::qt::RowWrapper> rows);
     void moveRow(
         ui::internal::Row* newParent,
         ui::internal::Row* newBefore,
@@ -92,10 +98,15 @@ public slots:
         ui::internal::Row* parent,
         ui::internal::Row* row) noexcept;
     void requestDeleteRow(ui::internal::Row* row) noexcept;
+    void requestDeleteRows(QVector<ui::internal::Row*> rows) noexcept;
     void requestInsertRow(
         ui::internal::Row* parent,
         ui::internal::Row* after,
         std::shared_ptr<ui::internal::Row> row) noexcept;
+    void requestInsertRows(
+        ui::internal::Row* parent,
+        ui::internal::Row* after,
+        QVector<opentxs::ui::qt::RowWrapper> rows) noexcept;
     void requestMoveRow(
         ui::internal::Row* newParent,
         ui::internal::Row* newBefore,
@@ -145,10 +156,15 @@ protected:
 private slots:
     void changeRow(ui::internal::Row* parent, ui::internal::Row* row) noexcept;
     void deleteRow(ui::internal::Row* row) noexcept;
+    void deleteRows(QVector<ui::internal::Row*> rows) noexcept;
     void insertRow(
         ui::internal::Row* parent,
         ui::internal::Row* after,
         opentxs::ui::qt::RowWrapper row) noexcept;
+    void insertRows(
+        ui::internal::Row* parent,
+        ui::internal::Row* after,
+        QVector<opentxs::ui::qt::RowWrapper> rows) noexcept;
     void moveRow(
         ui::internal::Row* newParent,
         ui::internal::Row* newBefore,
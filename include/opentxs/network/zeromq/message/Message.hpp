@@ -93,8 +93,12 @@ public:
 
     auto AddFrame() noexcept -> Frame&;
     auto AddFrame(const Amount& amount) noexcept -> Frame&;
+    /// Shares the payload of the frame instead of copying it
+    auto AddFrame(const Frame& frame) noexcept -> Frame&;
     auto AddFrame(Frame&& frame) noexcept -> Frame&;
     auto AddFrame(const char*) noexcept -> Frame&;
+    /// Takes ownership of the buffer instead of copying it
+    auto AddFrame(Space&& input) noexcept -> Frame&;
     template <
         typename Input,
         typename = std::enable_if_t<
@@ -14,7 +14,6 @@ extern "C" {
 #endif
 
 #include <cstdlib>
-#include <future>
 #include <iostream>
 #include <memory>
 #include <string_view>
@@ -22,15 +21,9 @@ extern "C" {
 
 #include "internal/api/Factory.hpp"
 #include "internal/util/Log.hpp"
-#include "internal/util/LogMacros.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
-#include "opentxs/network/zeromq/ListenCallback.hpp"
-#include "opentxs/network/zeromq/message/Frame.hpp"
-#include "opentxs/network/zeromq/message/FrameSection.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
-#include "opentxs/network/zeromq/socket/Pull.hpp"
-#include "opentxs/network/zeromq/socket/Types.hpp"
 
 namespace zmq = opentxs::network::zeromq;
 
@@ -40,7 +33,6 @@ auto Log(const zmq::Context& zmq, std::string_view endpoint) noexcept
     -> std::unique_ptr<api::internal::Log>
 {
     using ReturnType = api::imp::Log;
-    internal::Log::Start();
 
     return std::make_unique<ReturnType>(zmq, UnallocatedCString{endpoint});
 }
@@ -49,51 +41,39 @@ auto Log(const zmq::Context& zmq, std::string_view endpoint) noexcept
 namespace opentxs::api::imp
 {
 Log::Log(const zmq::Context& zmq, const UnallocatedCString endpoint)
-    : callback_(opentxs::network::zeromq::ListenCallback::Factory(
-          [&](auto&& msg) -> void { callback(std::move(msg)); }))
-    , socket_(zmq.PullSocket(callback_, zmq::socket::Direction::Bind))
-    , publish_socket_(zmq.PublishSocket())
+    : publish_socket_(zmq.PublishSocket())
     , publish_{!endpoint.empty()}
 {
-    const auto started = socket_->Start(opentxs::internal::Log::Endpoint());
-
-    if (false == started) { abort(); }
-
     if (publish_) {
         const auto publishStarted = publish_socket_->Start(endpoint);
         if (false == publishStarted) { abort(); }
     }
+
+    opentxs::internal::Log::Start(
+        [this](auto level, auto text, auto thread) {
+            callback(level, text, thread);
+        });
 }
 
-auto Log::callback(zmq::Message&& message) noexcept -> void
+auto Log::callback(
+    const int level,
+    const std::string_view text,
+    const std::string_view thread) noexcept -> void
 {
-    if (message.Body().size() < 3) { return; }
-
-    const auto& levelFrame = message.Body_at(0);
-    const auto text = UnallocatedCString{message.Body_at(1).Bytes()};
-    const auto id = UnallocatedCString{message.Body_at(2).Bytes()};
-
-    try {
-        const auto level = levelFrame.as<int>();
-
+    const auto id = UnallocatedCString{thread};
 #ifdef ANDROID
-        print_android(level, text, id);
+    print_android(level, UnallocatedCString{text}, id);
 #else
-        print(level, text, id);
+    print(level, UnallocatedCString{text}, id);
 #endif
-    } catch (...) {
-        std::cout << "Invalid level size: " << levelFrame.size() << '\n';
-
-        OT_FAIL;
-    }
 
-    if (publish_) { publish_socket_->Send(std::move(message)); }
-
-    if (message.Body().size() >= 4) {
-        const auto& promiseFrame = message.Body_at(3);
-        auto* pPromise = promiseFrame.as<std::promise<void>*>();
-
-        if (nullptr != pPromise) { pPromise->set_value(); }
+    if (publish_) {
+        auto message = zmq::Message{};
+        message.StartBody();
+        message.AddFrame(level);
+        message.AddFrame(text);
+        message.AddFrame(thread);
+        publish_socket_->Send(std::move(message));
     }
 }
 
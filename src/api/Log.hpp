@@ -5,11 +5,10 @@
 
 #pragma once
 
-#include "internal/api/Log.hpp"
+#include <string_view>
 
-#include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "internal/api/Log.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
-#include "opentxs/network/zeromq/socket/Pull.hpp"
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -22,7 +21,6 @@ namespace network
 namespace zeromq
 {
 class Context;
-class Message;
 }  // namespace zeromq
 }  // namespace network
 // }  // namespace v1
@@ -40,12 +38,13 @@ public:
     ~Log() final = default;
 
 private:
-    OTZMQListenCallback callback_;
-    OTZMQPullSocket socket_;
     OTZMQPublishSocket publish_socket_;
     const bool publish_;
 
-    auto callback(opentxs::network::zeromq::Message&& message) noexcept -> void;
+    auto callback(
+        const int level,
+        const std::string_view text,
+        const std::string_view thread) noexcept -> void;
     void print(
         const int level,
         const UnallocatedCString& text,
@@ -106,6 +106,11 @@ BalanceOracle::Imp::Imp(
                    {CString{api.Endpoints().BlockchainWalletUpdated(), alloc},
                     Direction::Bind},
                }},
+          },
+          {},
+          {
+              {Work::update_chain_balance, {CoalesceMode::latest, 1u}},
+              {Work::update_nym_balance, {CoalesceMode::latest, 2u}},
           })
     , api_(api)
     , router_(pipeline_.Internal().ExtraSocket(0))
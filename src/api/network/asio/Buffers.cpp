@@ -34,6 +34,18 @@ struct Buffers::Imp {
 
         return {id, boost::asio::buffer(buffer.data(), buffer.size())};
     }
+    auto release(Index id) noexcept -> Space
+    {
+        auto lock = Lock{lock_};
+        auto output = Space{};
+
+        if (auto i = buffers_.find(id); buffers_.end() != i) {
+            output.swap(i->second);
+            buffers_.erase(i);
+        }
+
+        return output;
+    }
 
 private:
     mutable std::mutex lock_{};
@@ -54,6 +66,11 @@ auto Buffers::get(const std::size_t bytes) noexcept
     return imp_->get(bytes);
 }
 
+auto Buffers::release(Index id) noexcept -> Space
+{
+    return imp_->release(id);
+}
+
 Buffers::~Buffers()
 {
     if (nullptr != imp_) {
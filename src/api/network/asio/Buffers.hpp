@@ -11,6 +11,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "opentxs/util/Bytes.hpp"
+
 namespace opentxs::api::network::asio
 {
 class Buffers
@@ -23,6 +25,7 @@ public:
 
     auto clear(Index id) noexcept -> void;
     auto get(const std::size_t bytes) noexcept -> std::pair<Index, AsioBuffer>;
+    auto release(Index id) noexcept -> Space;
 
     Buffers() noexcept;
 
@@ -378,7 +378,7 @@ auto Asio::Imp::Receive(
         [this, connection{space(id)}, type, bufData, address{endpoint.str()}](
             const auto& e, auto size) {
             data_socket_->Send([&] {
-                const auto& [index, buffer] = bufData;
+                const auto index = bufData.first;
                 auto work =
                     opentxs::network::zeromq::tagged_reply_to_connection(
                         reader(connection),
@@ -390,7 +390,9 @@ auto Asio::Imp::Receive(
                         .Flush();
                     work.AddFrame(address);
                 } else {
-                    work.AddFrame(buffer.data(), buffer.size());
+                    // NOTE hand the receive buffer to the frame rather than
+                    // copying what might be an entire block
+                    work.AddFrame(buffers_.release(index));
                 }
 
                 OT_ASSERT(1 < work.Body().size());
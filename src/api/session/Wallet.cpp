@@ -127,14 +127,10 @@ Wallet::Wallet(const api::Session& api)
     , unit_map_()
     , issuer_map_()
     , create_nym_lock_()
-    , account_map_lock_()
-    , nym_map_lock_()
     , server_map_lock_()
     , unit_map_lock_()
     , issuer_map_lock_()
-    , peer_map_lock_()
     , peer_lock_()
-    , nymfile_map_lock_()
     , nymfile_lock_()
     , purse_lock_()
     , purse_map_()
@@ -234,12 +230,15 @@ auto Wallet::account(
     const Identifier& account,
     const bool create) const -> Wallet::AccountLock&
 {
-    OT_ASSERT(CheckLock(lock, account_map_lock_))
+    auto& shard = account_map_.get(account);
 
-    auto& row = account_map_[account];
+    OT_ASSERT(CheckLock(lock, shard.lock_))
+
+    auto& row = shard.map_[account];
     auto& [rowMutex, pAccount] = row;
 
     if (pAccount) {
+        shard.Hit();
         LogVerbose()(OT_PRETTY_CLASS())("Account ")(
             account)(" already exists in map.")
             .Flush();
@@ -247,6 +246,7 @@ auto Wallet::account(
         return row;
     }
 
+    shard.Miss();
     eLock rowLock(rowMutex);
     // What if more than one thread tries to create the same row at the same
     // time? One thread will construct the Account object and the other(s) will
@@ -284,7 +284,7 @@ auto Wallet::account(
 
 auto Wallet::Account(const Identifier& accountID) const -> SharedAccount
 {
-    Lock mapLock(account_map_lock_);
+    Lock mapLock(account_map_.get(accountID).lock_);
 
     try {
         auto& [rowMutex, pAccount] = account(mapLock, accountID, false);
@@ -474,8 +474,6 @@ auto Wallet::CreateAccount(
     TransactionNumber stash,
     const PasswordPrompt& reason) const -> ExclusiveAccount
 {
-    Lock mapLock(account_map_lock_);
-
     try {
         const auto contract = UnitDefinition(instrumentDefinitionID);
         std::unique_ptr<opentxs::Account> newAccount(
@@ -493,6 +491,7 @@ auto Wallet::CreateAccount(
         OT_ASSERT(newAccount)
 
         const auto& accountID = newAccount->GetRealAccountID();
+        Lock mapLock(account_map_.get(accountID).lock_);
         auto& [rowMutex, pAccount] = account(mapLock, accountID, true);
 
         if (pAccount) {
@@ -550,7 +549,7 @@ auto Wallet::DefaultNym() const noexcept -> std::pair<OTNymID, std::size_t>
 
 auto Wallet::DeleteAccount(const Identifier& accountID) const -> bool
 {
-    Lock mapLock(account_map_lock_);
+    Lock mapLock(account_map_.get(accountID).lock_);
 
     try {
         auto& [rowMutex, pAccount] = account(mapLock, accountID, false);
@@ -577,10 +576,10 @@ auto Wallet::IssuerAccount(const identifier::UnitDefinition& unitID) const
     -> SharedAccount
 {
     const auto accounts = api_.Storage().AccountsByContract(unitID);
-    Lock mapLock(account_map_lock_);
 
     try {
         for (const auto& accountID : accounts) {
+            Lock mapLock(account_map_.get(accountID).lock_);
             auto& [rowMutex, pAccount] = account(mapLock, accountID, false);
 
             if (pAccount) {
@@ -603,7 +602,7 @@ auto Wallet::mutable_Account(
     const PasswordPrompt& reason,
     const AccountCallback callback) const -> ExclusiveAccount
 {
-    Lock mapLock(account_map_lock_);
+    Lock mapLock(account_map_.get(accountID).lock_);
 
     try {
         auto& [rowMutex, pAccount] = account(mapLock, accountID, false);
@@ -645,7 +644,7 @@ auto Wallet::UpdateAccount(
     const UnallocatedCString& label,
     const PasswordPrompt& reason) const -> bool
 {
-    Lock mapLock(account_map_lock_);
+    Lock mapLock(account_map_.get(accountID).lock_);
     auto& [rowMutex, pAccount] = account(mapLock, accountID, true);
     eLock rowLock(rowMutex);
     mapLock.unlock();
@@ -909,7 +908,7 @@ auto Wallet::ImportAccount(std::unique_ptr<opentxs::Account>& imported) const
     }
 
     const auto& accountID = imported->GetRealAccountID();
-    Lock mapLock(account_map_lock_);
+    Lock mapLock(account_map_.get(accountID).lock_);
 
     try {
         auto& [rowMutex, pAccount] = account(mapLock, accountID, true);
@@ -1105,54 +1104,69 @@ auto Wallet::Nym(
         return nullptr;
     }
 
-    auto mapLock = Lock{nym_map_lock_};
-    bool inMap = (nym_map_.find(id) != nym_map_.end());
-    bool valid = false;
+    auto& shard = nym_map_.get(id);
 
-    if (!inMap) {
-        auto serialized = proto::Nym{};
-        auto alias = UnallocatedCString{};
-        bool loaded = api_.Storage().Load(id, serialized, alias, true);
+    {
+        auto mapLock = sLock{shard.lock_};
+        const auto it = shard.map_.find(id);
 
-        if (loaded) {
-            auto& pNym = nym_map_[id].second;
-            pNym.reset(opentxs::Factory::Nym(api_, serialized, alias));
+        if (shard.map_.end() != it) {
+            shard.Hit();
+            const auto& row = it->second;
 
-            if (pNym && pNym->CompareID(id)) {
-                valid = pNym->VerifyPseudonym();
-                pNym->SetAliasStartup(alias);
-            } else {
-                nym_map_.erase(id);
-            }
-        } else {
-            search_nym(id);
+            if (row.valid_) { return row.nym_; }
 
-            if (timeout > 0ms) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = 100ms;
+            return nullptr;
+        }
+    }
 
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (nym_map_.find(id) != nym_map_.end());
-                    mapLock.unlock();
+    shard.Miss();
+    auto serialized = proto::Nym{};
+    auto alias = UnallocatedCString{};
+    bool loaded = api_.Storage().Load(id, serialized, alias, true);
 
-                    if (found) { break; }
-                }
+    if (loaded) {
+        // Construct and verify the nym before taking the shard lock so that
+        // lookups of other nyms are not blocked by signature verification
+        auto pNym = std::shared_ptr<identity::internal::Nym>{
+            opentxs::Factory::Nym(api_, serialized, alias)};
+
+        if (false == (pNym && pNym->CompareID(id))) { return nullptr; }
+
+        const auto valid = pNym->VerifyPseudonym();
+        pNym->SetAliasStartup(alias);
+        auto mapLock = eLock{shard.lock_};
+        auto& row = shard.map_[id];
+
+        // Another thread may have added this nym while it was being loaded
+        if (false == bool(row.nym_)) {
+            row.nym_ = std::move(pNym);
+            row.valid_ = valid;
+        }
+
+        if (row.valid_) { return row.nym_; }
+    } else {
+        search_nym(id);
+
+        if (timeout > 0ms) {
+            auto start = std::chrono::high_resolution_clock::now();
+            auto end = start + timeout;
+            const auto interval = 100ms;
 
-                return Nym(id);  // timeout of zero prevents infinite
-                                 // recursion
+            while (std::chrono::high_resolution_clock::now() < end) {
+                std::this_thread::sleep_for(interval);
+                auto mapLock = sLock{shard.lock_};
+                bool found = (shard.map_.find(id) != shard.map_.end());
+                mapLock.unlock();
+
+                if (found) { break; }
             }
+
+            return Nym(id);  // timeout of zero prevents infinite
+                             // recursion
         }
-    } else {
-        auto& pNym = nym_map_[id].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
     }
 
-    if (valid) { return nym_map_[id].second; }
-
     return nullptr;
 }
 
@@ -1190,12 +1204,14 @@ auto Wallet::Nym(const proto::Nym& serialized) const -> Nym_p
             candidate.WriteCredentials();
             SaveCredentialIDs(candidate);
             auto mapNym = [&] {
-                auto mapLock = Lock{nym_map_lock_};
-                auto& out = nym_map_[nymID].second;
+                auto& shard = nym_map_.get(nymID.get());
+                auto mapLock = eLock{shard.lock_};
+                auto& row = shard.map_[nymID];
                 // TODO update existing nym rather than destroying it
-                out.reset(pCandidate.release());
+                row.nym_.reset(pCandidate.release());
+                row.valid_ = true;
 
-                return out;
+                return row.nym_;
             }();
 
             notify_new(nymID);
@@ -1255,15 +1271,16 @@ auto Wallet::Nym(
     const auto first = (0u == LocalNymCount());
     auto& nym = *pNym;
     const auto& id = nym.ID();
+    auto& shard = nym_map_.get(id);
 
     if (nym.VerifyPseudonym()) {
         nym.SetAlias(name);
 
         {
-            auto mapLock = Lock{nym_map_lock_};
-            auto it = nym_map_.find(id);
+            auto mapLock = sLock{shard.lock_};
+            auto it = shard.map_.find(id);
 
-            if (nym_map_.end() != it) { return it->second.second; }
+            if (shard.map_.end() != it) { return it->second.nym_; }
         }
 
         if (SaveCredentialIDs(nym)) {
@@ -1283,9 +1300,10 @@ auto Wallet::Nym(
             }
 
             {
-                auto mapLock = Lock{nym_map_lock_};
-                auto& pMapNym = nym_map_[id].second;
-                pMapNym = pNym;
+                auto mapLock = eLock{shard.lock_};
+                auto& row = shard.map_[id];
+                row.nym_ = pNym;
+                row.valid_ = true;
                 nym_created_publisher_->Send([&] {
                     auto work = opentxs::network::zeromq::tagged_message(
                         WorkType::NymCreated);
@@ -1318,18 +1336,23 @@ auto Wallet::mutable_Nym(
         LogError()(OT_PRETTY_CLASS())("Nym ")(nym)(" not found.").Flush();
     }
 
-    auto mapLock = Lock{nym_map_lock_};
-    auto it = nym_map_.find(id);
+    auto& shard = nym_map_.get(id);
+    auto mapLock = sLock{shard.lock_};
+    auto it = shard.map_.find(id);
 
-    if (nym_map_.end() == it) { OT_FAIL }
+    if (shard.map_.end() == it) { OT_FAIL }
 
+    auto& row = it->second;
+    auto pNym = std::shared_ptr<identity::Nym>{row.nym_};
+    // The row mutex must never be acquired while holding the shard lock
+    // because save() takes the shard lock while the row mutex is held
+    mapLock.unlock();
     std::function<void(NymData*, Lock&)> callback = [&](NymData* nymData,
                                                         Lock& lock) -> void {
         this->save(nymData, lock);
     };
 
-    return NymData(
-        api_.Factory(), it->second.first, it->second.second, callback);
+    return NymData(api_.Factory(), row.lock_, pNym, callback);
 }
 
 auto Wallet::Nymfile(const identifier::Nym& id, const PasswordPrompt& reason)
@@ -1415,11 +1438,10 @@ auto Wallet::notify_new(const identifier::Nym& id) const noexcept -> void
 
 auto Wallet::nymfile_lock(const identifier::Nym& nymID) const -> std::mutex&
 {
-    Lock map_lock(nymfile_map_lock_);
-    auto& output = nymfile_lock_[Identifier::Factory(nymID)];
-    map_lock.unlock();
+    auto& shard = nymfile_lock_.get(nymID);
+    Lock map_lock(shard.lock_);
 
-    return output;
+    return shard.map_[Identifier::Factory(nymID)];
 }
 
 auto Wallet::NymByIDPartialMatch(const UnallocatedCString& hint) const -> Nym_p
@@ -1461,11 +1483,10 @@ auto Wallet::NymNameByIndex(const std::size_t index, String& name) const -> bool
 
 auto Wallet::peer_lock(const UnallocatedCString& nymID) const -> std::mutex&
 {
-    Lock map_lock(peer_map_lock_);
-    auto& output = peer_lock_[nymID];
-    map_lock.unlock();
+    auto& shard = peer_lock_.get(nymID);
+    Lock map_lock(shard.lock_);
 
-    return output;
+    return shard.map_[nymID];
 }
 
 auto Wallet::PeerReply(
@@ -2609,8 +2630,24 @@ void Wallet::save(NymData* nymData, const Lock& lock) const
     OT_ASSERT(nullptr != nymData);
     OT_ASSERT(lock.owns_lock())
 
-    SaveCredentialIDs(nymData->nym());
-    notify_changed(nymData->nym().ID());
+    const auto& nym = nymData->nym();
+    SaveCredentialIDs(nym);
+    const auto valid = nym.VerifyPseudonym();
+
+    {
+        const auto& id = nym.ID();
+        auto& shard = nym_map_.get(id);
+        auto mapLock = sLock{shard.lock_};
+        auto it = shard.map_.find(id);
+
+        if (shard.map_.end() != it) {
+            auto& row = it->second;
+
+            if (row.nym_.get() == &nym) { row.valid_ = valid; }
+        }
+    }
+
+    notify_changed(nym.ID());
 }
 
 void Wallet::save(
@@ -2750,9 +2787,17 @@ auto Wallet::SetNymAlias(
     const identifier::Nym& id,
     const UnallocatedCString& alias) const -> bool
 {
-    auto mapLock = Lock{nym_map_lock_};
-    auto& nym = nym_map_[id].second;
-    nym->SetAlias(alias);
+    {
+        auto& shard = nym_map_.get(id);
+        auto mapLock = sLock{shard.lock_};
+        auto it = shard.map_.find(id);
+
+        if (shard.map_.end() != it) {
+            const auto& nym = it->second.nym_;
+
+            if (nym) { nym->SetAlias(alias); }
+        }
+    }
 
     return api_.Storage().SetNymAlias(id, alias);
 }
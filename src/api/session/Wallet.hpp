@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cs_deferred_guarded.h>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <ctime>
@@ -57,6 +58,7 @@
 #include "opentxs/util/NymEditor.hpp"
 #include "opentxs/util/Types.hpp"
 #include "serialization/protobuf/ContactEnums.pb.h"
+#include "util/Sharded.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -160,6 +162,10 @@ class Wallet : virtual public internal::Wallet, public Lockable
 {
 public:
     auto Account(const Identifier& accountID) const -> SharedAccount final;
+    auto AccountCacheStatistics() const noexcept -> ShardedStatistics final
+    {
+        return account_map_.Stats();
+    }
     auto AccountPartialMatch(const UnallocatedCString& hint) const
         -> OTIdentifier final;
     auto CreateAccount(
@@ -245,6 +251,10 @@ public:
     auto mutable_Nymfile(
         const identifier::Nym& id,
         const PasswordPrompt& reason) const -> Editor<opentxs::NymFile> final;
+    auto NymCacheStatistics() const noexcept -> ShardedStatistics final
+    {
+        return nym_map_.Stats();
+    }
     auto NymByIDPartialMatch(const UnallocatedCString& partialId) const
         -> Nym_p final;
     auto NymList() const -> ObjectList final;
@@ -456,10 +466,24 @@ protected:
     Wallet(const api::Session& api);
 
 private:
-    using AccountMap = UnallocatedMap<OTIdentifier, AccountLock>;
-    using NymLock =
-        std::pair<std::mutex, std::shared_ptr<identity::internal::Nym>>;
-    using NymMap = UnallocatedMap<OTNymID, NymLock>;
+    struct NymLock {
+        std::mutex lock_{};
+        std::shared_ptr<identity::internal::Nym> nym_{};
+        // Result of the most recent VerifyPseudonym() call for nym_, which
+        // only changes when the nym is replaced or edited through NymData
+        std::atomic_bool valid_{false};
+    };
+
+    using AccountMap =
+        Sharded<OTIdentifier, AccountLock, ShardByIdentifier, std::mutex>;
+    using NymMap = Sharded<OTNymID, NymLock, ShardByIdentifier>;
+    using NymfileLockMap =
+        Sharded<OTIdentifier, std::mutex, ShardByIdentifier, std::mutex>;
+    using PeerLockMap = Sharded<
+        UnallocatedCString,
+        std::mutex,
+        std::hash<UnallocatedCString>,
+        std::mutex>;
     using ServerMap =
         UnallocatedMap<OTNotaryID, std::shared_ptr<contract::Server>>;
     using UnitMap = UnallocatedMap<OTUnitID, std::shared_ptr<contract::Unit>>;
@@ -485,15 +509,11 @@ private:
     mutable UnitMap unit_map_;
     mutable IssuerMap issuer_map_;
     mutable std::mutex create_nym_lock_;
-    mutable std::mutex account_map_lock_;
-    mutable std::mutex nym_map_lock_;
     mutable std::mutex server_map_lock_;
     mutable std::mutex unit_map_lock_;
     mutable std::mutex issuer_map_lock_;
-    mutable std::mutex peer_map_lock_;
-    mutable UnallocatedMap<UnallocatedCString, std::mutex> peer_lock_;
-    mutable std::mutex nymfile_map_lock_;
-    mutable UnallocatedMap<OTIdentifier, std::mutex> nymfile_lock_;
+    mutable PeerLockMap peer_lock_;
+    mutable NymfileLockMap nymfile_lock_;
     mutable std::mutex purse_lock_;
     mutable PurseMap purse_map_;
     OTZMQPublishSocket account_publisher_;
@@ -17,9 +17,11 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -31,6 +33,7 @@
 #include "internal/serialization/protobuf/verify/GCS.hpp"
 #include "internal/util/BoostPMR.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -278,21 +281,220 @@ auto GCS(
 
 namespace opentxs::gcs
 {
-using BitReader = blockchain::internal::BitReader;
 using BitWriter = blockchain::internal::BitWriter;
 
-static auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(
-    false) -> Delta
+static auto leading_zeros(const std::uint64_t in) noexcept -> std::size_t
 {
-    auto quotient = Delta{0};
+    if (0u == in) { return 64u; }
 
-    while (1 == stream.read(1)) { quotient++; }
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_clzll(in));
+#else
+    auto out = std::size_t{0};
 
-    auto remainder = stream.read(P);
+    for (auto mask = std::uint64_t{1u} << 63u; 0u == (in & mask); mask >>= 1u) {
+        ++out;
+    }
 
-    return Delta{(quotient << P) + remainder};
+    return out;
+#endif
 }
 
+// Reads Golomb-Rice coded values from a big endian bit stream a machine word
+// at a time. The unary quotient is consumed with a single leading zero count
+// instead of one bit at a time. Reading past the end of the input throws.
+class GolombReader
+{
+public:
+    auto Decode(const std::uint8_t P) noexcept(false) -> Delta
+    {
+        auto quotient = Delta{0};
+
+        while (true) {
+            refill();
+
+            if (0u == bits_) { truncated(); }
+
+            const auto ones = std::min(leading_zeros(~window_), bits_);
+            quotient += ones;
+
+            if (ones < bits_) {
+                consume(ones + 1u);
+
+                break;
+            }
+
+            consume(ones);
+        }
+
+        refill();
+
+        if (bits_ < P) { truncated(); }
+
+        const auto remainder = (0u == P) ? Delta{0} : (window_ >> (64u - P));
+        consume(P);
+
+        return Delta{(quotient << P) + remainder};
+    }
+
+    GolombReader(const Vector<std::byte>& data) noexcept
+        : next_(reinterpret_cast<const std::uint8_t*>(data.data()))
+        , end_(next_ + data.size())
+        , window_(0)
+        , bits_(0)
+    {
+    }
+
+private:
+    const std::uint8_t* next_;
+    const std::uint8_t* const end_;
+    // NOTE the next unread bit is the most significant bit of window_
+    std::uint64_t window_;
+    std::size_t bits_;
+
+    auto consume(const std::size_t bits) noexcept -> void
+    {
+        window_ = (64u > bits) ? (window_ << bits) : std::uint64_t{0};
+        bits_ -= bits;
+    }
+    auto refill() noexcept -> void
+    {
+        while ((56u >= bits_) && (end_ != next_)) {
+            window_ |= std::uint64_t{*next_++} << (56u - bits_);
+            bits_ += 8u;
+        }
+    }
+    [[noreturn]] static auto truncated() noexcept(false) -> void
+    {
+        throw std::out_of_range("Golomb coded set is truncated");
+    }
+};
+
+// Native SipHash-2-4 with the key expanded once. Runs of items which have
+// the same length are hashed in lock step so the compiler can keep several
+// independent states in flight and vectorize the rounds.
+class SipHasher
+{
+public:
+    static constexpr auto lanes_ = std::size_t{4};
+
+    auto operator()(const ReadView item) const noexcept -> Hash
+    {
+        auto out = Hash{};
+        this->operator()<1>(&item, &out);
+
+        return out;
+    }
+    template <std::size_t Lanes>
+    auto operator()(const ReadView* items, Hash* out) const noexcept -> void
+    {
+        std::uint64_t v0[Lanes];
+        std::uint64_t v1[Lanes];
+        std::uint64_t v2[Lanes];
+        std::uint64_t v3[Lanes];
+        std::uint64_t m[Lanes];
+        const auto size = items[0].size();
+
+        for (auto l = std::size_t{0}; l < Lanes; ++l) {
+            OT_ASSERT(items[l].size() == size);
+
+            v0[l] = k0_ ^ 0x736f6d6570736575ull;
+            v1[l] = k1_ ^ 0x646f72616e646f6dull;
+            v2[l] = k0_ ^ 0x6c7967656e657261ull;
+            v3[l] = k1_ ^ 0x7465646279746573ull;
+        }
+
+        const auto blocks = size / 8u;
+        const auto tail = size % 8u;
+        const auto compress = [&] {
+            for (auto l = std::size_t{0}; l < Lanes; ++l) { v3[l] ^= m[l]; }
+
+            round<Lanes>(v0, v1, v2, v3);
+            round<Lanes>(v0, v1, v2, v3);
+
+            for (auto l = std::size_t{0}; l < Lanes; ++l) { v0[l] ^= m[l]; }
+        };
+
+        for (auto b = std::size_t{0}; b < blocks; ++b) {
+            for (auto l = std::size_t{0}; l < Lanes; ++l) {
+                m[l] = load(items[l].data() + (b * 8u), 8u);
+            }
+
+            compress();
+        }
+
+        for (auto l = std::size_t{0}; l < Lanes; ++l) {
+            m[l] = (std::uint64_t{size} << 56u) |
+                   load(items[l].data() + (blocks * 8u), tail);
+        }
+
+        compress();
+
+        for (auto l = std::size_t{0}; l < Lanes; ++l) { v2[l] ^= 0xff; }
+
+        for (auto r = 0; r < 4; ++r) { round<Lanes>(v0, v1, v2, v3); }
+
+        for (auto l = std::size_t{0}; l < Lanes; ++l) {
+            out[l] = v0[l] ^ v1[l] ^ v2[l] ^ v3[l];
+        }
+    }
+
+    SipHasher(const ReadView key) noexcept(false)
+        : k0_()
+        , k1_()
+    {
+        if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
+
+        k0_ = load(key.data(), 8u);
+        k1_ = load(key.data() + 8u, 8u);
+    }
+
+private:
+    std::uint64_t k0_;
+    std::uint64_t k1_;
+
+    static auto load(const char* in, const std::size_t bytes) noexcept
+        -> std::uint64_t
+    {
+        auto out = std::uint64_t{0};
+
+        for (auto i = std::size_t{0}; i < bytes; ++i) {
+            out |= std::uint64_t{static_cast<std::uint8_t>(in[i])} << (8u * i);
+        }
+
+        return out;
+    }
+    static constexpr auto rotl(const std::uint64_t x, const int b) noexcept
+        -> std::uint64_t
+    {
+        return (x << b) | (x >> (64 - b));
+    }
+    template <std::size_t Lanes>
+    static auto round(
+        std::uint64_t* v0,
+        std::uint64_t* v1,
+        std::uint64_t* v2,
+        std::uint64_t* v3) noexcept -> void
+    {
+        for (auto l = std::size_t{0}; l < Lanes; ++l) {
+            v0[l] += v1[l];
+            v1[l] = rotl(v1[l], 13);
+            v1[l] ^= v0[l];
+            v0[l] = rotl(v0[l], 32);
+            v2[l] += v3[l];
+            v3[l] = rotl(v3[l], 16);
+            v3[l] ^= v2[l];
+            v0[l] += v3[l];
+            v3[l] = rotl(v3[l], 21);
+            v3[l] ^= v0[l];
+            v2[l] += v1[l];
+            v1[l] = rotl(v1[l], 17);
+            v1[l] ^= v2[l];
+            v2[l] = rotl(v2[l], 32);
+        }
+    }
+};
+
 static auto golomb_encode(
     const std::uint8_t P,
     const Delta value,
@@ -317,11 +519,12 @@ auto GolombDecode(
     alloc::Default alloc) noexcept(false) -> Elements
 {
     auto output = Elements{alloc};
-    auto stream = BitReader{encoded};
+    output.reserve(N);
+    auto stream = GolombReader{encoded};
     auto last = Element{0};
 
     for (auto i = std::size_t{0}; i < N; ++i) {
-        auto delta = golomb_decode(P, stream);
+        auto delta = stream.Decode(P);
         auto value = last + delta;
         output.emplace_back(value);
         last = value;
@@ -353,6 +556,33 @@ auto GolombEncode(
     return output;
 }
 
+auto GolombMatch(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    const Elements& targets,
+    alloc::Default alloc) noexcept(false) -> Elements
+{
+    auto output = Elements{alloc};
+    auto stream = GolombReader{encoded};
+    auto last = Element{0};
+    auto target = targets.cbegin();
+    const auto end = targets.cend();
+
+    for (auto i = std::size_t{0}; (i < N) && (target != end); ++i) {
+        last += stream.Decode(P);
+
+        while ((target != end) && (*target < last)) { ++target; }
+
+        if ((target != end) && (*target == last)) {
+            output.emplace_back(last);
+            ++target;
+        }
+    }
+
+    return output;
+}
+
 auto HashToRange(
     const api::Session& api,
     const ReadView key,
@@ -369,20 +599,18 @@ auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element
 }
 
 auto HashedSetConstruct(
-    const api::Session& api,
+    [[maybe_unused]] const api::Session& api,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
     const blockchain::GCS::Targets& items,
     alloc::Default alloc) noexcept(false) -> Elements
 {
-    auto output = Elements{alloc};
+    auto output = SiphashBatch(key, items, alloc);
+    const auto F = range(N, M);
     std::transform(
-        std::begin(items),
-        std::end(items),
-        std::back_inserter(output),
-        [&](const auto& item) {
-            return HashToRange(api, key, range(N, M), item);
+        output.begin(), output.end(), output.begin(), [&](const auto& hash) {
+            return HashToRange(F, hash);
         });
     std::sort(output.begin(), output.end());
 
@@ -406,10 +634,125 @@ auto Siphash(
 
     return output;
 }
+
+auto SiphashBatch(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes
+{
+    constexpr auto lanes = SipHasher::lanes_;
+    const auto siphash = SipHasher{key};
+    auto output = Hashes{alloc};
+    output.resize(items.size());
+    const auto count = items.size();
+    auto i = std::size_t{0};
+
+    while (i < count) {
+        const auto* item = items.data() + i;
+        auto* out = output.data() + i;
+        const auto same = [&] {
+            if ((count - i) < lanes) { return false; }
+
+            for (auto l = std::size_t{1}; l < lanes; ++l) {
+                if (item[l].size() != item[0].size()) { return false; }
+            }
+
+            return true;
+        }();
+
+        if (same) {
+            siphash.operator()<lanes>(item, out);
+            i += lanes;
+        } else {
+            *out = siphash(*item);
+            ++i;
+        }
+    }
+
+    return output;
+}
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::implementation
 {
+// Decoded filters shared by every GCS instance in the process, so subchains
+// which scan the same blocks only pay for decoding each filter once.
+class DecodedCache
+{
+public:
+    using Set = std::shared_ptr<const gcs::Elements>;
+
+    static auto Get() noexcept -> DecodedCache&
+    {
+        static auto cache = DecodedCache{};
+
+        return cache;
+    }
+
+    auto Find(const UnallocatedCString& id) noexcept -> Set
+    {
+        auto lock = Lock{lock_};
+        const auto i = index_.find(id);
+
+        if (index_.end() == i) { return {}; }
+
+        auto& position = i->second;
+        lru_.splice(lru_.end(), lru_, position);
+
+        return position->second;
+    }
+    auto Insert(const UnallocatedCString& id, Set set) noexcept -> Set
+    {
+        OT_ASSERT(set);
+
+        auto lock = Lock{lock_};
+
+        if (auto i = index_.find(id); index_.end() != i) {
+
+            return i->second->second;
+        }
+
+        bytes_ += cost(id, *set);
+        index_.emplace(id, lru_.emplace(lru_.end(), id, set));
+
+        while ((bytes_ > limit_) && (1u < lru_.size())) {
+            const auto& [oldID, oldSet] = lru_.front();
+            bytes_ -= cost(oldID, *oldSet);
+            index_.erase(oldID);
+            lru_.pop_front();
+        }
+
+        return set;
+    }
+
+private:
+    using LRU = UnallocatedList<std::pair<UnallocatedCString, Set>>;
+    using Index = UnallocatedMap<UnallocatedCString, LRU::iterator>;
+
+    static constexpr auto limit_ = std::size_t{32u * 1024u * 1024u};
+
+    std::mutex lock_;
+    LRU lru_;
+    Index index_;
+    std::size_t bytes_;
+
+    // NOTE the id is stored twice: once in the lru list and once in the index
+    static auto cost(
+        const UnallocatedCString& id,
+        const gcs::Elements& set) noexcept -> std::size_t
+    {
+        return (2u * id.size()) + (set.size() * sizeof(gcs::Element));
+    }
+
+    DecodedCache() noexcept
+        : lock_()
+        , lru_()
+        , index_()
+        , bytes_(0)
+    {
+    }
+};
+
 GCS::GCS(
     const VersionNumber version,
     const api::Session& api,
@@ -429,6 +772,8 @@ GCS::GCS(
     , key_()
     , compressed_(std::move(compressed), alloc)
     , elements_(std::move(elements))
+    , shared_()
+    , cache_id_()
 {
     static_assert(16u == sizeof(key_));
 
@@ -532,15 +877,67 @@ auto GCS::Compressed(AllocateOutput out) const noexcept -> bool
     return copy(reader(compressed_), out);
 }
 
-auto GCS::decompress() const noexcept -> const gcs::Elements&
+auto GCS::cache_id() const noexcept -> const UnallocatedCString&
 {
-    if (false == elements_.has_value()) {
-        auto& set = elements_;
-        set = gcs::GolombDecode(count_, bits_, compressed_, alloc_);
-        std::sort(set.value().begin(), set.value().end());
+    if (false == cache_id_.empty()) { return cache_id_; }
+
+    auto& out = cache_id_;
+    // NOTE a digest of the encoded filter is part of the id because filters
+    // of different types for the same block share a key and may share
+    // parameters
+    auto digest = Space{};
+
+    if (false == api_.Crypto().Hash().Digest(
+                     crypto::HashType::Sha256,
+                     reader(compressed_),
+                     writer(digest))) {
+        LogError()(OT_PRETTY_CLASS())("Failed to hash filter").Flush();
+        // NOTE fall back to the filter itself so that distinct filters
+        // never share an id
+        copy(reader(compressed_), writer(digest));
     }
 
-    return elements_.value();
+    out.reserve(
+        key_.size() + sizeof(count_) + sizeof(false_positive_rate_) + 1u +
+        digest.size());
+    out.append(reinterpret_cast<const char*>(key_.data()), key_.size());
+    out.append(reinterpret_cast<const char*>(&count_), sizeof(count_));
+    out.append(
+        reinterpret_cast<const char*>(&false_positive_rate_),
+        sizeof(false_positive_rate_));
+    out.append(1u, static_cast<char>(bits_));
+    out.append(reinterpret_cast<const char*>(digest.data()), digest.size());
+
+    return out;
+}
+
+auto GCS::cached() const noexcept -> const gcs::Elements*
+{
+    if (elements_.has_value()) { return &elements_.value(); }
+
+    if (!shared_) { shared_ = DecodedCache::Get().Find(cache_id()); }
+
+    return shared_.get();
+}
+
+auto GCS::decoded() const noexcept -> const gcs::Elements*
+{
+    if (const auto* set = cached(); nullptr != set) { return set; }
+
+    try {
+        shared_ = DecodedCache::Get().Insert(
+            cache_id(),
+            std::make_shared<const gcs::Elements>(
+                gcs::GolombDecode(count_, bits_, compressed_, {})));
+
+        return shared_.get();
+    } catch (const std::exception& e) {
+        // NOTE nothing is cached so every query against an undecodable filter
+        // is reported
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return nullptr;
+    }
 }
 
 auto GCS::Encode(AllocateOutput cb) const noexcept -> bool
@@ -613,6 +1010,7 @@ auto GCS::hashed_set_construct(const gcs::Hashes& targets, allocator_type alloc)
         targets.end(),
         std::back_inserter(out),
         [&](const auto& hash) { return gcs::HashToRange(range, hash); });
+    dedup(out);
 
     return out;
 }
@@ -653,8 +1051,6 @@ auto GCS::Match(const Targets& targets, allocator_type alloc) const noexcept
         sizeof(gcs::Element) + sizeof(Map::value_type);
     auto buf = std::array<std::byte, reserveMatches * bytesPerMatch>{};
     auto allocMatches = alloc::BoostMonotonic{buf.data(), buf.size()};
-    auto matches = gcs::Elements{&allocMatches};
-    matches.reserve(reserveMatches);
     auto map = Map{&allocMatches};
 
     for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
@@ -663,13 +1059,7 @@ auto GCS::Match(const Targets& targets, allocator_type alloc) const noexcept
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    const auto matches = match(hashed, &allocMatches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -693,8 +1083,6 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
         sizeof(gcs::Element) + sizeof(Map::value_type);
     auto buf = std::array<std::byte, reserveMatches * bytesPerMatch>{};
     auto allocMatches = alloc::BoostMonotonic{buf.data(), buf.size()};
-    auto matches = gcs::Elements{&allocMatches};
-    matches.reserve(reserveMatches);
     auto map = Map{&allocMatches};
     const auto range = Range();
 
@@ -704,13 +1092,7 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    const auto matches = match(hashed, &allocMatches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -720,6 +1102,67 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
     return output;
 }
 
+auto GCS::Match(const PrehashedTargets& prehashed) const noexcept
+    -> std::optional<Vector<PrehashedMatches>>
+{
+    auto output = Vector<PrehashedMatches>{prehashed.get_allocator()};
+    output.reserve(prehashed.size());
+    using Candidate =
+        std::tuple<gcs::Element, std::size_t, gcs::Hashes::const_iterator>;
+    auto count = std::size_t{0};
+
+    for (const auto* hashes : prehashed) {
+        OT_ASSERT(nullptr != hashes);
+
+        output.emplace_back(hashes->get_allocator());
+        count += hashes->size();
+    }
+
+    if (0u == count) { return output; }
+
+    auto alloc = alloc::BoostMonotonic{
+        count * (sizeof(Candidate) + sizeof(gcs::Element)) +
+        (2u * sizeof(Candidate))};
+    auto candidates = Vector<Candidate>{&alloc};
+    candidates.reserve(count);
+    const auto range = Range();
+
+    for (auto n = std::size_t{0}; n < prehashed.size(); ++n) {
+        const auto& hashes = *prehashed.at(n);
+
+        for (auto i = hashes.cbegin(); i != hashes.cend(); ++i) {
+            candidates.emplace_back(gcs::HashToRange(range, *i), n, i);
+        }
+    }
+
+    std::sort(
+        candidates.begin(),
+        candidates.end(),
+        [](const auto& lhs, const auto& rhs) {
+            return std::get<0>(lhs) < std::get<0>(rhs);
+        });
+    const auto* set = decoded();
+
+    if (nullptr == set) { return std::nullopt; }
+
+    auto element = set->cbegin();
+    const auto end = set->cend();
+
+    for (const auto& [hash, n, i] : candidates) {
+        while ((end != element) && (*element < hash)) { ++element; }
+
+        if (end == element) { break; }
+
+        if (*element == hash) { output.at(n).emplace_back(i); }
+    }
+
+    for (auto& matches : output) {
+        std::sort(matches.begin(), matches.end());
+    }
+
+    return output;
+}
+
 auto GCS::Range() const noexcept -> gcs::Range
 {
     return range(count_, false_positive_rate_);
@@ -768,19 +1211,7 @@ auto GCS::Test(const ReadView target) const noexcept -> bool
 
     OT_ASSERT(1 == set.size());
 
-    const auto& hash = set.front();
-
-    for (const auto& element : decompress()) {
-        if (element == hash) {
-
-            return true;
-        } else if (element > hash) {
-
-            return false;
-        }
-    }
-
-    return false;
+    return test(set);
 }
 
 auto GCS::Test(const Vector<OTData>& targets) const noexcept -> bool
@@ -810,19 +1241,37 @@ auto GCS::Test(const gcs::Hashes& targets) const noexcept -> bool
     return test(hashed_set_construct(targets, &alloc));
 }
 
+auto GCS::match(const gcs::Elements& targets, allocator_type alloc)
+    const noexcept -> gcs::Elements
+{
+    auto output = gcs::Elements{alloc};
+
+    if (const auto* set = cached(); nullptr != set) {
+        std::set_intersection(
+            std::begin(targets),
+            std::end(targets),
+            std::begin(*set),
+            std::end(*set),
+            std::back_inserter(output));
+
+        return output;
+    }
+
+    try {
+
+        return gcs::GolombMatch(count_, bits_, compressed_, targets, alloc);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return output;
+    }
+}
+
 auto GCS::test(const gcs::Elements& targets) const noexcept -> bool
 {
-    const auto& set = decompress();
     auto alloc = alloc::BoostMonotonic{1024};
-    auto matches = Vector<gcs::Element>{&alloc};
-    std::set_intersection(
-        std::begin(targets),
-        std::end(targets),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
-
-    return 0 < matches.size();
+
+    return 0 < match(targets, &alloc).size();
 }
 
 auto GCS::transform(const Vector<OTData>& in, allocator_type alloc) noexcept
@@ -87,6 +87,11 @@ public:
     {
         return {};
     }
+    auto Match(const PrehashedTargets& prehashed) const noexcept
+        -> std::optional<Vector<PrehashedMatches>> override
+    {
+        return {};
+    }
     auto Range() const noexcept -> gcs::Range override { return {}; }
     auto Serialize(proto::GCS& out) const noexcept -> bool override
     {
@@ -143,6 +148,8 @@ public:
     auto Match(const Targets&, allocator_type) const noexcept -> Matches final;
     auto Match(const gcs::Hashes& prehashed) const noexcept
         -> PrehashedMatches final;
+    auto Match(const PrehashedTargets& prehashed) const noexcept
+        -> std::optional<Vector<PrehashedMatches>> final;
     auto Range() const noexcept -> gcs::Range final;
     auto Serialize(proto::GCS& out) const noexcept -> bool final;
     auto Serialize(AllocateOutput out) const noexcept -> bool final;
@@ -188,6 +195,8 @@ private:
     const Key key_;
     const Vector<std::byte> compressed_;
     mutable std::optional<gcs::Elements> elements_;
+    mutable std::shared_ptr<const gcs::Elements> shared_;
+    mutable UnallocatedCString cache_id_;
 
     static auto transform(
         const Vector<OTData>& in,
@@ -196,7 +205,9 @@ private:
         const Vector<Space>& in,
         allocator_type alloc) noexcept -> Targets;
 
-    auto decompress() const noexcept -> const gcs::Elements&;
+    auto cache_id() const noexcept -> const UnallocatedCString&;
+    auto cached() const noexcept -> const gcs::Elements*;
+    auto decoded() const noexcept -> const gcs::Elements*;
     auto hashed_set_construct(
         const Vector<OTData>& elements,
         allocator_type alloc) const noexcept -> gcs::Elements;
@@ -207,6 +218,8 @@ private:
         const noexcept -> gcs::Elements;
     auto hashed_set_construct(const Targets& elements, allocator_type alloc)
         const noexcept -> gcs::Elements;
+    auto match(const gcs::Elements& targetHashes, allocator_type alloc)
+        const noexcept -> gcs::Elements;
     auto test(const gcs::Elements& targetHashes) const noexcept -> bool;
     auto hash_to_range(const ReadView in) const noexcept -> gcs::Range;
 
@@ -16,14 +16,17 @@
 #include <functional>
 #include <iosfwd>
 #include <iterator>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include "blockchain/block/Block.hpp"
 #include "blockchain/block/bitcoin/BlockParser.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -209,24 +212,29 @@ auto parse_normal_block(
         (blockchain::Type::PKT != chain) &&
         (blockchain::Type::PKT_testnet != chain));
 
+    // NOTE the input may be a view of a mapped file or a network buffer, so
+    // the block keeps its own copy and decodes transactions from it on demand
+    const auto serialized = std::make_shared<const Space>(space(in));
+    const auto bytes = reader(*serialized);
     auto it = ByteIterator{};
     auto expectedSize = std::size_t{};
-    auto pHeader = parse_header(api, chain, in, it, expectedSize);
+    auto pHeader = parse_header(api, chain, bytes, it, expectedSize);
 
     OT_ASSERT(pHeader);
 
     const auto& header = *pHeader;
     auto sizeData = BlockReturnType::CalculatedSize{
-        in.size(), network::blockchain::bitcoin::CompactSize{}};
-    auto [index, transactions] =
-        parse_transactions(api, chain, in, header, sizeData, it, expectedSize);
+        bytes.size(), network::blockchain::bitcoin::CompactSize{}};
+    auto [index, encoded] = index_transactions(
+        api, chain, bytes, header, sizeData, it, expectedSize);
 
     return std::make_shared<BlockReturnType>(
         api,
         chain,
         std::move(pHeader),
         std::move(index),
-        std::move(transactions),
+        serialized,
+        std::move(encoded),
         std::move(sizeData));
 }
 }  // namespace opentxs::factory
@@ -238,26 +246,50 @@ const Block::value_type Block::null_tx_{};
 
 Block::Block(
     const api::Session& api,
-    const blockchain::Type chain,
     std::unique_ptr<const internal::Header> header,
     TxidIndex&& index,
     TransactionMap&& transactions,
+    std::shared_ptr<const Space> serialized,
+    EncodedTransactions&& encoded,
     std::optional<CalculatedSize>&& size) noexcept(false)
     : block::implementation::Block(api, *header)
     , header_p_(std::move(header))
     , header_(*header_p_)
     , index_(std::move(index))
     , transactions_(std::move(transactions))
+    , serialized_(std::move(serialized))
+    , encoded_(std::move(encoded))
+    , position_([&] {
+        auto out = UnallocatedMap<ReadView, std::size_t>{};
+
+        if (serialized_) {
+            for (auto i = std::size_t{0}; i < index_.size(); ++i) {
+                out.emplace(reader(index_[i]), i);
+            }
+        }
+
+        return out;
+    }())
+    , decoded_(encoded_.size())
+    , once_(encoded_.size())
     , size_(std::move(size))
 {
-    if (index_.size() != transactions_.size()) {
-        throw std::runtime_error("Invalid transaction index");
-    }
-
     if (false == bool(header_p_)) {
         throw std::runtime_error("Invalid header");
     }
 
+    if (lazy()) {
+        if (index_.size() != encoded_.size()) {
+            throw std::runtime_error("Invalid transaction index");
+        }
+
+        return;
+    }
+
+    if (index_.size() != transactions_.size()) {
+        throw std::runtime_error("Invalid transaction index");
+    }
+
     for (const auto& [txid, tx] : transactions_) {
         if (false == bool(tx)) {
             throw std::runtime_error("Invalid transaction");
@@ -265,6 +297,49 @@ Block::Block(
     }
 }
 
+Block::Block(
+    const api::Session& api,
+    const blockchain::Type,
+    std::unique_ptr<const internal::Header> header,
+    TxidIndex&& index,
+    TransactionMap&& transactions,
+    std::optional<CalculatedSize>&& size) noexcept(false)
+    : Block(
+          api,
+          std::move(header),
+          std::move(index),
+          std::move(transactions),
+          nullptr,
+          {},
+          std::move(size))
+{
+}
+
+Block::Block(
+    const api::Session& api,
+    const blockchain::Type,
+    std::unique_ptr<const internal::Header> header,
+    TxidIndex&& index,
+    std::shared_ptr<const Space> serialized,
+    EncodedTransactions&& encoded,
+    CalculatedSize&& size) noexcept(false)
+    : Block(
+          api,
+          std::move(header),
+          std::move(index),
+          {},
+          [&] {
+              if (false == bool(serialized)) {
+                  throw std::runtime_error("Invalid serialized block");
+              }
+
+              return std::move(serialized);
+          }(),
+          std::move(encoded),
+          std::move(size))
+{
+}
+
 auto Block::at(const std::size_t index) const noexcept -> const value_type&
 {
     try {
@@ -272,6 +347,8 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
             throw std::out_of_range("invalid index " + std::to_string(index));
         }
 
+        if (lazy()) { return get(index); }
+
         return at(reader(index_.at(index)));
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
@@ -283,6 +360,7 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
 auto Block::at(const ReadView txid) const noexcept -> const value_type&
 {
     try {
+        if (lazy()) { return get(position_.at(txid)); }
 
         return transactions_.at(txid);
     } catch (...) {
@@ -383,8 +461,21 @@ auto Block::calculate_merkle_value(
 auto Block::calculate_size() const noexcept -> CalculatedSize
 {
     auto output = CalculatedSize{
-        0, network::blockchain::bitcoin::CompactSize(transactions_.size())};
+        0, network::blockchain::bitcoin::CompactSize(index_.size())};
     auto& [bytes, cs] = output;
+
+    if (lazy()) {
+        bytes = std::accumulate(
+            std::begin(encoded_),
+            std::end(encoded_),
+            header_bytes_ + cs.Size() + extra_bytes(),
+            [](const auto& previous, const auto& in) -> std::size_t {
+                return previous + in.size();
+            });
+
+        return output;
+    }
+
     auto cb = [](const auto& previous, const auto& in) -> std::size_t {
         return previous + in.second->Internal().CalculateSize();
     };
@@ -397,20 +488,61 @@ auto Block::calculate_size() const noexcept -> CalculatedSize
     return output;
 }
 
-auto Block::ExtractElements(const cfilter::Type style) const noexcept
+auto Block::decode(const std::size_t position) const noexcept -> value_type
+{
+    try {
+        auto tx = factory::BitcoinTransaction(
+            api_,
+            header_.Type(),
+            position,
+            header_.Timestamp(),
+            blockchain::bitcoin::EncodedTransaction::Deserialize(
+                api_, header_.Type(), encoded_.at(position)));
+
+        if (false == bool(tx)) {
+            throw std::runtime_error("failed to instantiate transaction");
+        }
+
+        return tx;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())("transaction ")(position)(" of block ")(
+            header_.Hash().asHex())(": ")(e.what())
+            .Flush();
+
+        return {};
+    }
+}
+
+auto Block::ExtractElements(const cfilter::Type style) const noexcept(false)
     -> Vector<Vector<std::byte>>
 {
     auto output = Vector<Vector<std::byte>>{};
-    LogTrace()(OT_PRETTY_CLASS())("processing ")(transactions_.size())(
+    LogTrace()(OT_PRETTY_CLASS())("processing ")(index_.size())(
         " transactions")
         .Flush();
-
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->Internal().ExtractElements(style);
+    const auto extract = [&](const auto& tx) {
+        auto temp = tx.Internal().ExtractElements(style);
         output.insert(
             output.end(),
             std::make_move_iterator(temp.begin()),
             std::make_move_iterator(temp.end()));
+    };
+
+    if (lazy()) {
+        // NOTE transactions decoded here are not retained so that building a
+        // filter does not materialize the entire block
+        for (auto i = std::size_t{0}; i < encoded_.size(); ++i) {
+            const auto tx = decode(i);
+
+            if (false == bool(tx)) {
+                throw std::runtime_error(
+                    "failed to decode transaction " + std::to_string(i));
+            }
+
+            extract(*tx);
+        }
+    } else {
+        for (const auto& [txid, tx] : transactions_) { extract(*tx); }
     }
 
     LogTrace()(OT_PRETTY_CLASS())("extracted ")(output.size())(" elements")
@@ -429,14 +561,13 @@ auto Block::FindMatches(
 
     LogTrace()(OT_PRETTY_CLASS())("Verifying ")(
         patterns.size() + outpoints.size())(" potential matches in ")(
-        transactions_.size())(" transactions")
+        index_.size())(" transactions")
         .Flush();
     auto output = Matches{};
     auto& [inputs, outputs] = output;
     const auto parsed = block::ParsedPatterns{patterns};
-
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->Internal().FindMatches(style, outpoints, parsed);
+    const auto find = [&](const auto& tx) {
+        auto temp = tx.Internal().FindMatches(style, outpoints, parsed);
         inputs.insert(
             inputs.end(),
             std::make_move_iterator(temp.first.begin()),
@@ -445,6 +576,27 @@ auto Block::FindMatches(
             outputs.end(),
             std::make_move_iterator(temp.second.begin()),
             std::make_move_iterator(temp.second.end()));
+    };
+
+    if (lazy()) {
+        // NOTE every outpoint and element a transaction can match appears
+        // verbatim in its serialized form, so only transactions which
+        // contain at least one of them need to be decoded
+        const auto contains = [](const ReadView tx, const Patterns& in) {
+            return std::any_of(in.begin(), in.end(), [&](const auto& item) {
+                return ReadView::npos != tx.find(reader(item.second));
+            });
+        };
+
+        for (auto i = std::size_t{0}; i < encoded_.size(); ++i) {
+            const auto& bytes = encoded_[i];
+
+            if (contains(bytes, outpoints) || contains(bytes, patterns)) {
+                if (const auto& tx = get(i); tx) { find(*tx); }
+            }
+        }
+    } else {
+        for (const auto& [txid, tx] : transactions_) { find(*tx); }
     }
 
     dedup(inputs);
@@ -453,6 +605,17 @@ auto Block::FindMatches(
     return output;
 }
 
+auto Block::get(const std::size_t position) const noexcept -> const value_type&
+{
+    OT_ASSERT(position < decoded_.size());
+
+    std::call_once(once_[position], [&] {
+        decoded_[position] = decode(position);
+    });
+
+    return decoded_[position];
+}
+
 auto Block::get_or_calculate_size() const noexcept -> CalculatedSize
 {
     if (false == size_.has_value()) { size_ = calculate_size(); }
@@ -495,6 +658,12 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
         return false;
     }
 
+    if (lazy() && (serialized_->size() == size)) {
+        std::memcpy(out.data(), serialized_->data(), size);
+
+        return true;
+    }
+
     LogInsane()(OT_PRETTY_CLASS())("Serializing ")(txCount.Value())(
         " transactions into ")(size)(" bytes.")
         .Flush();
@@ -529,9 +698,11 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
 
     for (const auto& txid : index_) {
         try {
-            const auto& pTX = transactions_.at(reader(txid));
+            const auto& pTX = at(reader(txid));
 
-            OT_ASSERT(pTX);
+            if (false == bool(pTX)) {
+                throw std::runtime_error{"missing transaction"};
+            }
 
             const auto& tx = *pTX;
             const auto encoded =
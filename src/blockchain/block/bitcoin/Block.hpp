@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string_view>
 #include <utility>
@@ -69,6 +70,7 @@ public:
         std::pair<std::size_t, network::blockchain::bitcoin::CompactSize>;
     using TxidIndex = UnallocatedVector<Space>;
     using TransactionMap = UnallocatedMap<ReadView, value_type>;
+    using EncodedTransactions = UnallocatedVector<ReadView>;
 
     static const std::size_t header_bytes_;
 
@@ -106,7 +108,7 @@ public:
         return const_iterator(this, index_.size());
     }
     auto end() const noexcept -> const_iterator final { return cend(); }
-    auto ExtractElements(const cfilter::Type style) const noexcept
+    auto ExtractElements(const cfilter::Type style) const noexcept(false)
         -> Vector<Vector<std::byte>> final;
     auto FindMatches(
         const cfilter::Type type,
@@ -123,6 +125,16 @@ public:
         TxidIndex&& index,
         TransactionMap&& transactions,
         std::optional<CalculatedSize>&& size = {}) noexcept(false);
+    /// Each transaction is decoded from the serialized block the first time
+    /// it is accessed. The elements of encoded must point into serialized.
+    Block(
+        const api::Session& api,
+        const blockchain::Type chain,
+        std::unique_ptr<const internal::Header> header,
+        TxidIndex&& index,
+        std::shared_ptr<const Space> serialized,
+        EncodedTransactions&& encoded,
+        CalculatedSize&& size) noexcept(false);
     ~Block() override;
 
 protected:
@@ -135,14 +147,30 @@ private:
     const internal::Header& header_;
     const TxidIndex index_;
     const TransactionMap transactions_;
+    const std::shared_ptr<const Space> serialized_;
+    const EncodedTransactions encoded_;
+    const UnallocatedMap<ReadView, std::size_t> position_;
+    mutable UnallocatedVector<value_type> decoded_;
+    mutable UnallocatedVector<std::once_flag> once_;
     mutable std::optional<CalculatedSize> size_;
 
     auto calculate_size() const noexcept -> CalculatedSize;
+    auto decode(const std::size_t position) const noexcept -> value_type;
     virtual auto extra_bytes() const noexcept -> std::size_t { return 0; }
+    auto get(const std::size_t position) const noexcept -> const value_type&;
     auto get_or_calculate_size() const noexcept -> CalculatedSize;
+    auto lazy() const noexcept -> bool { return bool(serialized_); }
     virtual auto serialize_post_header(ByteIterator& it, std::size_t& remaining)
         const noexcept -> bool;
 
+    Block(
+        const api::Session& api,
+        std::unique_ptr<const internal::Header> header,
+        TxidIndex&& index,
+        TransactionMap&& transactions,
+        std::shared_ptr<const Space> serialized,
+        EncodedTransactions&& encoded,
+        std::optional<CalculatedSize>&& size) noexcept(false);
     Block() = delete;
     Block(const Block&) = delete;
     Block(Block&&) = delete;
@@ -7,20 +7,225 @@
 #include "1_Internal.hpp"                            // IWYU pragma: associated
 #include "blockchain/block/bitcoin/BlockParser.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/bitcoin/Header.hpp"
 #include "opentxs/core/FixedByteArray.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/util/Container.hpp"
+#include "util/Parallel.hpp"
 
 namespace opentxs::factory
 {
+// NOTE blocks with fewer transactions than this are parsed on the calling
+// thread because dispatching jobs would cost more than it saves
+constexpr auto parallel_threshold_ = std::size_t{256};
+constexpr auto transactions_per_job_ = std::size_t{64};
+constexpr auto merkle_pairs_per_job_ = std::size_t{512};
+
+using LocatedTransactions = UnallocatedVector<ReadView>;
+
+// Returns the serialized size of the transaction at the start of the input
+// without decoding it
+static auto transaction_layout(const ReadView in) noexcept(false)
+    -> std::size_t
+{
+    using network::blockchain::bitcoin::DecodeSize;
+
+    if ((nullptr == in.data()) || (0 == in.size())) {
+        throw std::runtime_error("Invalid bytes");
+    }
+
+    const auto total = in.size();
+    auto it = reinterpret_cast<ByteIterator>(in.data());
+    auto expectedSize = std::size_t{4};
+    auto count = std::size_t{};
+    auto bytes = std::size_t{};
+    const auto skip = [&](const std::size_t size, const char* error) {
+        expectedSize += size;
+
+        if (total < expectedSize) { throw std::runtime_error(error); }
+
+        std::advance(it, size);
+    };
+    const auto size = [&](std::size_t& out, const char* error) {
+        expectedSize += 1;
+
+        if ((total < expectedSize) ||
+            (false == DecodeSize(it, expectedSize, total, out))) {
+            throw std::runtime_error(error);
+        }
+    };
+
+    if (total < expectedSize) {
+        throw std::runtime_error("Partial transaction (version)");
+    }
+
+    std::advance(it, 4);
+    const auto segwit =
+        blockchain::bitcoin::HasSegwit(it, expectedSize, total).has_value();
+    size(count, "Partial transaction (txin count)");
+    const auto inputs = count;
+
+    for (auto i = std::size_t{0}; i < inputs; ++i) {
+        skip(36, "Partial input (outpoint)");
+        size(bytes, "Partial input (script size)");
+        skip(bytes, "Partial input (script)");
+        skip(4, "Partial input (sequence)");
+    }
+
+    size(count, "Partial transaction (txout count)");
+
+    for (auto i = std::size_t{0}, outputs = count; i < outputs; ++i) {
+        skip(8, "Partial output (value)");
+        size(bytes, "Partial output (script size)");
+        skip(bytes, "Partial output (script)");
+    }
+
+    if (segwit) {
+        for (auto i = std::size_t{0}; i < inputs; ++i) {
+            size(count, "Failed to witness item count");
+
+            for (auto w = std::size_t{0}, pushes = count; w < pushes; ++w) {
+                size(bytes, "Failed to witness item bytes");
+                skip(bytes, "Partial witness item");
+            }
+        }
+    }
+
+    skip(4, "Partial transaction (lock time)");
+
+    return expectedSize;
+}
+
+// Reads the transaction count and finds the boundaries of every transaction
+static auto locate_transactions(
+    const ReadView in,
+    BlockReturnType::CalculatedSize& sizeData,
+    ByteIterator& it,
+    std::size_t& expectedSize) noexcept(false) -> LocatedTransactions
+{
+    expectedSize += 1;
+
+    if (in.size() < expectedSize) {
+        throw std::runtime_error("Block size too short (transaction count)");
+    }
+
+    auto& [size, txCount] = sizeData;
+
+    if (false == network::blockchain::bitcoin::DecodeSize(
+                     it, expectedSize, in.size(), txCount)) {
+        throw std::runtime_error("Failed to decode transaction count");
+    }
+
+    const auto transactionCount = txCount.Value();
+
+    if (0 == transactionCount) { throw std::runtime_error("Empty block"); }
+
+    if (transactionCount > std::numeric_limits<int>::max()) {
+        throw std::runtime_error("too many transactions");
+    }
+
+    const auto count = static_cast<std::size_t>(transactionCount);
+    auto output = LocatedTransactions{};
+    output.reserve(count);
+
+    while (output.size() < count) {
+        const auto remaining = ReadView{
+            reinterpret_cast<const char*>(it), in.size() - expectedSize};
+        const auto txBytes = transaction_layout(remaining);
+        output.emplace_back(remaining.data(), txBytes);
+        std::advance(it, txBytes);
+        expectedSize += txBytes;
+    }
+
+    return output;
+}
+
+static auto merkle_root(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const BlockReturnType::TxidIndex& txids) noexcept(false)
+    -> blockchain::block::Hash
+{
+    if (txids.size() < parallel_threshold_) {
+
+        return BlockReturnType::calculate_merkle_value(api, chain, txids);
+    }
+
+    using Hash = std::array<std::byte, 32>;
+    const auto row = [&](const auto& in, UnallocatedVector<Hash>& out) {
+        const auto count = in.size();
+        const auto pairs = (count + 1u) / 2u;
+        out.resize(pairs);
+        const auto hash = [&](const std::size_t first, const std::size_t last) {
+            auto preimage = std::array<std::byte, 64>{};
+            constexpr auto chunk = preimage.size() / 2u;
+
+            for (auto p = first; p < last; ++p) {
+                const auto i = 2u * p;
+                const auto& lhs = in[i];
+                const auto& rhs = in[(1u == (count - i)) ? i : i + 1u];
+
+                if ((chunk != lhs.size()) || (chunk != rhs.size())) {
+                    throw std::runtime_error("Invalid hash size");
+                }
+
+                std::memcpy(preimage.data(), lhs.data(), chunk);
+                std::memcpy(preimage.data() + chunk, rhs.data(), chunk);
+                auto& next = out[p];
+                const auto hashed = blockchain::MerkleHash(
+                    api,
+                    chain,
+                    {reinterpret_cast<const char*>(preimage.data()),
+                     preimage.size()},
+                    preallocated(next.size(), next.data()));
+
+                if (false == hashed) {
+                    throw std::runtime_error("Failed to calculate merkle hash");
+                }
+            }
+        };
+
+        if (pairs < (2u * merkle_pairs_per_job_)) {
+            hash(0u, pairs);
+        } else {
+            const auto jobs =
+                (pairs + merkle_pairs_per_job_ - 1u) / merkle_pairs_per_job_;
+            RunParallel(
+                api, ThreadPool::Blockchain, jobs, [&](const std::size_t job) {
+                    const auto first = job * merkle_pairs_per_job_;
+                    hash(first, std::min(first + merkle_pairs_per_job_, pairs));
+                });
+        }
+    };
+    auto a = UnallocatedVector<Hash>{};
+    auto b = UnallocatedVector<Hash>{};
+    a.reserve((txids.size() + 1u) / 2u);
+    b.reserve(a.capacity());
+    row(txids, a);
+
+    while (1u < a.size()) {
+        row(a, b);
+        a.swap(b);
+    }
+
+    return reader(a.at(0));
+}
+
 auto parse_header(
     const api::Session& api,
     const blockchain::Type chain,
@@ -63,49 +268,110 @@ auto parse_transactions(
     ByteIterator& it,
     std::size_t& expectedSize) -> ParsedTransactions
 {
-    expectedSize += 1;
+    // NOTE locate every transaction first so they can be decoded in any order
+    const auto views = locate_transactions(in, sizeData, it, expectedSize);
+    const auto count = views.size();
+    using Transaction =
+        std::unique_ptr<blockchain::block::bitcoin::internal::Transaction>;
+    auto txids = BlockReturnType::TxidIndex(count);
+    auto decoded = UnallocatedVector<Transaction>(count);
+    const auto decode = [&](const std::size_t first, const std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            const auto& view = views[i];
+            auto data = blockchain::bitcoin::EncodedTransaction::Deserialize(
+                api, chain, view);
 
-    if (in.size() < expectedSize) {
-        throw std::runtime_error("Block size too short (transaction count)");
-    }
+            if (data.size() != view.size()) {
+                throw std::runtime_error("Transaction size mismatch");
+            }
 
-    auto& [size, txCount] = sizeData;
+            txids[i] = data.txid_;
+            decoded[i] = BitcoinTransaction(
+                api, chain, i, header.Timestamp(), std::move(data));
+        }
+    };
 
-    if (false == network::blockchain::bitcoin::DecodeSize(
-                     it, expectedSize, in.size(), txCount)) {
-        throw std::runtime_error("Failed to decode transaction count");
+    if (count < parallel_threshold_) {
+        decode(0u, count);
+    } else {
+        const auto jobs =
+            (count + transactions_per_job_ - 1u) / transactions_per_job_;
+        RunParallel(
+            api, ThreadPool::Blockchain, jobs, [&](const std::size_t job) {
+                const auto first = job * transactions_per_job_;
+                decode(first, std::min(first + transactions_per_job_, count));
+            });
     }
 
-    const auto transactionCount = txCount.Value();
+    auto output = ParsedTransactions{};
+    auto& [index, transactions] = output;
+    index = std::move(txids);
 
-    if (0 == transactionCount) { throw std::runtime_error("Empty block"); }
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        transactions.emplace(reader(index[i]), std::move(decoded[i]));
+    }
 
-    if (transactionCount > std::numeric_limits<int>::max()) {
-        throw std::runtime_error("too many transactions");
+    const auto merkle = merkle_root(api, chain, index);
+
+    if (header.MerkleRoot() != merkle) {
+        throw std::runtime_error("Invalid merkle hash");
     }
 
-    auto counter = int{-1};
-    auto output = ParsedTransactions{};
-    auto& [index, transactions] = output;
+    return output;
+}
 
-    while (transactions.size() < transactionCount) {
-        auto data = blockchain::bitcoin::EncodedTransaction::Deserialize(
-            api,
-            chain,
-            ReadView{
-                reinterpret_cast<const char*>(it), in.size() - expectedSize});
-        const auto txBytes = data.size();
-        std::advance(it, txBytes);
-        expectedSize += txBytes;
-        auto& txid = index.emplace_back(data.txid_);
-        transactions.emplace(
-            reader(txid),
-            BitcoinTransaction(
-                api, chain, ++counter, header.Timestamp(), std::move(data)));
+auto index_transactions(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const ReadView in,
+    const blockchain::block::bitcoin::Header& header,
+    BlockReturnType::CalculatedSize& sizeData,
+    ByteIterator& it,
+    std::size_t& expectedSize) -> IndexedTransactions
+{
+    const auto located = locate_transactions(in, sizeData, it, expectedSize);
+    const auto count = located.size();
+    auto output = IndexedTransactions{};
+    auto& [index, encoded] = output;
+    index.resize(count);
+    // NOTE every transaction is decoded in full so that a block containing
+    // one which can not be instantiated is rejected here, as it would be by
+    // parse_transactions. The decoded transactions are not retained.
+    const auto decode = [&](const std::size_t first, const std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            const auto& view = located[i];
+            auto data = blockchain::bitcoin::EncodedTransaction::Deserialize(
+                api, chain, view);
+
+            if (data.size() != view.size()) {
+                throw std::runtime_error("Transaction size mismatch");
+            }
+
+            index[i] = data.txid_;
+            const auto tx = BitcoinTransaction(
+                api, chain, i, header.Timestamp(), std::move(data));
+
+            if (false == bool(tx)) {
+                throw std::runtime_error(
+                    "Invalid transaction " + std::to_string(i));
+            }
+        }
+    };
+
+    if (count < parallel_threshold_) {
+        decode(0u, count);
+    } else {
+        const auto jobs =
+            (count + transactions_per_job_ - 1u) / transactions_per_job_;
+        RunParallel(
+            api, ThreadPool::Blockchain, jobs, [&](const std::size_t job) {
+                const auto first = job * transactions_per_job_;
+                decode(first, std::min(first + transactions_per_job_, count));
+            });
     }
 
-    const auto merkle =
-        BlockReturnType::calculate_merkle_value(api, chain, index);
+    encoded.assign(located.begin(), located.end());
+    const auto merkle = merkle_root(api, chain, index);
 
     if (header.MerkleRoot() != merkle) {
         throw std::runtime_error("Invalid merkle hash");
@@ -85,7 +85,17 @@ using BlockReturnType = blockchain::block::bitcoin::implementation::Block;
 using ByteIterator = const std::byte*;
 using ParsedTransactions =
     std::pair<BlockReturnType::TxidIndex, BlockReturnType::TransactionMap>;
+using IndexedTransactions =
+    std::pair<BlockReturnType::TxidIndex, BlockReturnType::EncodedTransactions>;
 
+auto index_transactions(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const ReadView in,
+    const blockchain::block::bitcoin::Header& header,
+    BlockReturnType::CalculatedSize& sizeData,
+    ByteIterator& it,
+    std::size_t& expectedSize) -> IndexedTransactions;
 auto parse_header(
     const api::Session& api,
     const blockchain::Type chain,
@@ -19,7 +19,10 @@
 #include "Proto.hpp"
 #include "blockchain/crypto/Element.hpp"
 #include "blockchain/crypto/Subaccount.hpp"
+#include "internal/api/Crypto.hpp"
 #include "internal/api/crypto/Blockchain.hpp"
+#include "internal/api/network/Asio.hpp"
+#include "internal/crypto/key/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
 #include "opentxs/api/crypto/Seed.hpp"
@@ -29,11 +32,15 @@
 #include "opentxs/blockchain/crypto/Account.hpp"
 #include "opentxs/blockchain/crypto/Element.hpp"
 #include "opentxs/blockchain/crypto/Wallet.hpp"
+#include "opentxs/crypto/Bip32.hpp"
 #include "opentxs/crypto/key/EllipticCurve.hpp"
+#include "opentxs/crypto/key/HD.hpp"
+#include "opentxs/crypto/key/asymmetric/Algorithm.hpp"
 #include "opentxs/crypto/key/asymmetric/Role.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "serialization/protobuf/HDPath.pb.h"
+#include "util/Parallel.hpp"
 
 namespace opentxs::blockchain::crypto::implementation
 {
@@ -124,6 +131,29 @@ auto Deterministic::accept(
     return index;
 }
 
+auto Deterministic::add_element(
+    const rLock&,
+    const Subchain type,
+    const opentxs::crypto::key::EllipticCurve& key) const noexcept(false)
+    -> Bip32Index
+{
+    auto& addressMap = data_.Get(type).map_;
+    auto& index = generated_.at(type);
+
+    OT_ASSERT(addressMap.size() == index);
+
+    const auto& blockchain = parent_.Parent().Parent();
+    const auto [it, added] = addressMap.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(index),
+        std::forward_as_tuple(std::make_unique<implementation::Element>(
+            api_, blockchain, *this, chain_, type, index, key, get_contact())));
+
+    if (false == added) { throw std::runtime_error("Failed to add key"); }
+
+    return index++;
+}
+
 auto Deterministic::AllowedSubchains() const noexcept
     -> UnallocatedSet<Subchain>
 {
@@ -277,9 +307,22 @@ auto Deterministic::check_lookahead(
 {
     auto needed = need_lookahead(lock, type);
 
-    while (0u < needed) {
-        generated.emplace_back(generate_next(lock, type, reason));
-        --needed;
+    if (0u == needed) { return; }
+
+    const auto keys =
+        derive_lookahead(lock, type, generated_.at(type), needed, reason);
+
+    if (keys.empty()) {
+        while (0u < needed) {
+            generated.emplace_back(generate_next(lock, type, reason));
+            --needed;
+        }
+    } else {
+        OT_ASSERT(keys.size() == needed);
+
+        for (const auto& key : keys) {
+            generated.emplace_back(add_element(lock, type, *key));
+        }
     }
 }
 
@@ -325,6 +368,72 @@ auto Deterministic::confirm(
     check_lookahead(lock, type, generated, reason);
 }
 
+auto Deterministic::derive_lookahead(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index first,
+    const Bip32Index count,
+    const PasswordPrompt& reason) const noexcept -> UnallocatedVector<ECKey>
+{
+    const auto* pParent = public_parent(lock, type, reason);
+
+    if (nullptr == pParent) { return {}; }
+
+    // NOTE let generate report a full account
+    if ((max_index_ <= first) || ((max_index_ - first) < count)) { return {}; }
+
+    const auto& parent = *pParent;
+    const auto& bip32 = api_.Crypto().BIP32();
+    const auto& ecdsa = api_.Crypto().Internal().EllipticProvider(
+        opentxs::crypto::key::asymmetric::Algorithm::Secp256k1);
+    const auto blank = api_.Factory().Secret(0);
+    auto output = UnallocatedVector<ECKey>(count);
+    const auto jobs = (count + keys_per_job_ - 1u) / keys_per_job_;
+
+    try {
+        RunParallel(api_, ThreadPool::General, jobs, [&](const auto job) {
+            const auto start = job * keys_per_job_;
+            const auto stop =
+                std::min<std::size_t>(start + keys_per_job_, count);
+
+            for (auto i = start; i < stop; ++i) {
+                const auto index = static_cast<Bip32Index>(first + i);
+                const auto [privkey, ccode, pubkey, path, fingerprint] =
+                    bip32.DerivePublicKey(parent, {index}, reason);
+                const auto hdPath = [&] {
+                    auto out = proto::HDPath{};
+                    parent.Path(out);
+                    out.add_child(index);
+
+                    return out;
+                }();
+                auto key = factory::Secp256k1Key(
+                    api_,
+                    ecdsa,
+                    blank,
+                    ccode,
+                    pubkey,
+                    hdPath,
+                    fingerprint,
+                    opentxs::crypto::key::asymmetric::Role::Sign,
+                    opentxs::crypto::key::EllipticCurve::DefaultVersion);
+
+                if (false == bool(key)) {
+                    throw std::runtime_error{"Failed to derive public key"};
+                }
+
+                output[i] = std::move(key);
+            }
+        });
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return {};
+    }
+
+    return output;
+}
+
 auto Deterministic::element(
     const rLock&,
     const Subchain type,
@@ -474,17 +583,7 @@ auto Deterministic::generate(
         throw std::runtime_error("Failed to generate key");
     }
 
-    const auto& key = *pKey;
-    const auto& blockchain = parent_.Parent().Parent();
-    const auto [it, added] = addressMap.emplace(
-        std::piecewise_construct,
-        std::forward_as_tuple(index),
-        std::forward_as_tuple(std::make_unique<implementation::Element>(
-            api_, blockchain, *this, chain_, type, index, key, get_contact())));
-
-    if (false == added) { throw std::runtime_error("Failed to add key"); }
-
-    return index++;
+    return add_element(lock, type, *pKey);
 }
 
 auto Deterministic::generate_next(
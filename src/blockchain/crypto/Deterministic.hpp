@@ -139,6 +139,7 @@ protected:
     static constexpr Bip32Index window_{20u};
     static constexpr Bip32Index max_allocation_{2000u};
     static constexpr Bip32Index max_index_{2147483648u};
+    static constexpr std::size_t keys_per_job_{25u};
 
     const proto::HDPath path_;
     mutable ChainData data_;
@@ -165,6 +166,16 @@ protected:
     }
     auto need_lookahead(const rLock& lock, const Subchain type) const noexcept
         -> Bip32Index;
+    /// Returns a public only account key for the specified subchain if
+    /// addresses on that subchain can be derived with non-hardened CKD
+    virtual auto public_parent(
+        const rLock&,
+        const Subchain,
+        const PasswordPrompt&) const noexcept
+        -> const opentxs::crypto::key::HD*
+    {
+        return nullptr;
+    }
     auto serialize_deterministic(const rLock& lock, SerializedType& out)
         const noexcept -> void;
     auto use_next(
@@ -259,6 +270,18 @@ private:
         const rLock& lock,
         const Batch& internal,
         const Batch& external) const noexcept -> bool;
+    [[nodiscard]] auto add_element(
+        const rLock& lock,
+        const Subchain type,
+        const opentxs::crypto::key::EllipticCurve& key) const noexcept(false)
+        -> Bip32Index;
+    auto derive_lookahead(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const Bip32Index count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<ECKey>;
     [[nodiscard]] auto generate(
         const rLock& lock,
         const Subchain type,
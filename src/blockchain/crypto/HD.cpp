@@ -20,12 +20,15 @@
 #include "blockchain/crypto/Deterministic.hpp"
 #include "blockchain/crypto/Element.hpp"
 #include "blockchain/crypto/Subaccount.hpp"
+#include "internal/api/Crypto.hpp"
 #include "internal/api/crypto/Seed.hpp"
 #include "internal/blockchain/crypto/Factory.hpp"
+#include "internal/crypto/key/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/crypto/Config.hpp"
 #include "opentxs/api/crypto/Seed.hpp"
 #include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/api/session/Storage.hpp"
 #include "opentxs/blockchain/Types.hpp"
@@ -40,6 +43,7 @@
 #include "opentxs/crypto/Bip32.hpp"
 #include "opentxs/crypto/Bip32Child.hpp"
 #include "opentxs/crypto/Bip43Purpose.hpp"
+#include "opentxs/crypto/key/asymmetric/Algorithm.hpp"
 #include "opentxs/identity/wot/claim/Types.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
@@ -112,6 +116,8 @@ HD::HD(
     , version_(DefaultVersion)
     , cached_internal_()
     , cached_external_()
+    , public_internal_()
+    , public_external_()
     , name_()
 {
     init(reason);
@@ -197,6 +203,8 @@ HD::HD(
     , version_(serialized.version())
     , cached_internal_()
     , cached_external_()
+    , public_internal_()
+    , public_external_()
     , name_()
 {
     init();
@@ -210,27 +218,11 @@ auto HD::account_already_exists(const rLock&) const noexcept -> bool
     return 0 < existing.count(id_->str());
 }
 
-auto HD::Name() const noexcept -> UnallocatedCString
-{
-    auto lock = rLock{lock_};
-
-    if (false == name_.has_value()) {
-        auto name = std::stringstream{};
-        name << print(standard_);
-        name << ": ";
-        name << opentxs::crypto::Print(path_, false);
-        name_ = name.str();
-    }
-
-    OT_ASSERT(name_.has_value());
-
-    return name_.value();
-}
-
-auto HD::PrivateKey(
+auto HD::account_key(
+    const rLock&,
     const Subchain type,
-    const Bip32Index index,
-    const PasswordPrompt& reason) const noexcept -> ECKey
+    const PasswordPrompt& reason) const noexcept
+    -> const opentxs::crypto::key::HD*
 {
     switch (type) {
         case internal_type_:
@@ -246,16 +238,15 @@ auto HD::PrivateKey(
                 print(external_type_))(" are valid for this account.")
                 .Flush();
 
-            return {};
+            return nullptr;
         }
     }
 
-    if (false == api::crypto::HaveHDKeys()) { return {}; }
+    if (false == api::crypto::HaveHDKeys()) { return nullptr; }
 
     const auto change =
         (internal_type_ == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
     auto& pKey = (internal_type_ == type) ? cached_internal_ : cached_external_;
-    auto lock = rLock{lock_};
 
     if (!pKey) {
         pKey =
@@ -265,17 +256,91 @@ auto HD::PrivateKey(
             LogError()(OT_PRETTY_CLASS())("Failed to derive account key")
                 .Flush();
 
-            return {};
+            return nullptr;
         }
     }
 
-    OT_ASSERT(pKey);
+    return pKey.get();
+}
+
+auto HD::Name() const noexcept -> UnallocatedCString
+{
+    auto lock = rLock{lock_};
+
+    if (false == name_.has_value()) {
+        auto name = std::stringstream{};
+        name << print(standard_);
+        name << ": ";
+        name << opentxs::crypto::Print(path_, false);
+        name_ = name.str();
+    }
+
+    OT_ASSERT(name_.has_value());
+
+    return name_.value();
+}
+
+auto HD::PrivateKey(
+    const Subchain type,
+    const Bip32Index index,
+    const PasswordPrompt& reason) const noexcept -> ECKey
+{
+    auto lock = rLock{lock_};
+    const auto* pKey = account_key(lock, type, reason);
+
+    if (nullptr == pKey) { return {}; }
 
     const auto& key = *pKey;
 
     return key.ChildKey(index, reason);
 }
 
+auto HD::public_parent(
+    const rLock& lock,
+    const Subchain type,
+    const PasswordPrompt& reason) const noexcept
+    -> const opentxs::crypto::key::HD*
+{
+    const auto* pKey = account_key(lock, type, reason);
+
+    if (nullptr == pKey) { return nullptr; }
+
+    auto& pPublic =
+        (internal_type_ == type) ? public_internal_ : public_external_;
+
+    if (pPublic) { return pPublic.get(); }
+
+    const auto& key = *pKey;
+    using Algorithm = opentxs::crypto::key::asymmetric::Algorithm;
+
+    if (Algorithm::Secp256k1 != key.keyType()) { return nullptr; }
+
+    const auto blank = api_.Factory().Secret(0);
+    const auto path = [&] {
+        auto out = proto::HDPath{};
+        key.Path(out);
+
+        return out;
+    }();
+    pPublic = factory::Secp256k1Key(
+        api_,
+        api_.Crypto().Internal().EllipticProvider(Algorithm::Secp256k1),
+        blank,
+        api_.Factory().SecretFromBytes(key.Chaincode(reason)),
+        api_.Factory().DataFromBytes(key.PublicKey()),
+        path,
+        key.Parent(),
+        key.Role(),
+        key.Version());
+
+    if (false == bool(pPublic)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to extract public account key")
+            .Flush();
+    }
+
+    return pPublic.get();
+}
+
 auto HD::save(const rLock& lock) const noexcept -> bool
 {
     const auto type = BlockchainToUnit(chain_);
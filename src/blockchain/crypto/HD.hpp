@@ -110,9 +110,21 @@ private:
     VersionNumber version_;
     mutable std::unique_ptr<opentxs::crypto::key::HD> cached_internal_;
     mutable std::unique_ptr<opentxs::crypto::key::HD> cached_external_;
+    mutable std::unique_ptr<opentxs::crypto::key::HD> public_internal_;
+    mutable std::unique_ptr<opentxs::crypto::key::HD> public_external_;
     mutable std::optional<UnallocatedCString> name_;
 
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto account_key(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept
+        -> const opentxs::crypto::key::HD*;
+    auto public_parent(
+        const rLock& lock,
+        const Subchain type,
+        const PasswordPrompt& reason) const noexcept
+        -> const opentxs::crypto::key::HD* final;
     auto save(const rLock& lock) const noexcept -> bool final;
 
     HD(const HD&) = delete;
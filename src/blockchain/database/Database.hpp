@@ -201,6 +201,15 @@ public:
     {
         return headers_.BestBlock(position);
     }
+    auto BestHeight(const block::Hash& hash) const noexcept
+        -> block::Height final
+    {
+        return headers_.BestHeight(hash);
+    }
+    auto BestPosition() const noexcept -> block::Position final
+    {
+        return headers_.BestPosition();
+    }
     auto BlockExists(const block::Hash& block) const noexcept -> bool final
     {
         return common_.BlockExists(block);
@@ -398,6 +407,13 @@ public:
     {
         return headers_.IsSibling(hash);
     }
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterCallback& cb) const noexcept -> std::size_t final
+    {
+        return filters_.LoadEncodedFilters(type, blocks, cb);
+    }
     auto LoadFilter(
         const cfilter::Type type,
         const ReadView block,
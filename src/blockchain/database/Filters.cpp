@@ -156,6 +156,14 @@ auto Filters::import_genesis(const blockchain::Type chain) const noexcept
     }
 }
 
+auto Filters::LoadEncodedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    const EncodedFilterCallback& cb) const noexcept -> std::size_t
+{
+    return common_.LoadEncodedFilters(type, blocks, cb);
+}
+
 auto Filters::LoadFilter(
     const cfilter::Type type,
     const ReadView block,
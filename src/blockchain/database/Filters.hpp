@@ -7,6 +7,7 @@
 
 #include <boost/container/flat_set.hpp>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <memory>
@@ -78,6 +79,7 @@ public:
     using Parent = node::internal::FilterDatabase;
     using CFHeaderParams = Parent::CFHeaderParams;
     using CFilterParams = Parent::CFilterParams;
+    using EncodedFilterCallback = Parent::EncodedFilterCallback;
 
     auto CurrentHeaderTip(const cfilter::Type type) const noexcept
         -> block::Position;
@@ -86,6 +88,10 @@ public:
         const noexcept -> bool;
     auto HaveFilterHeader(const cfilter::Type type, const block::Hash& block)
         const noexcept -> bool;
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterCallback& cb) const noexcept -> std::size_t;
     auto LoadFilter(
         const cfilter::Type type,
         const ReadView block,
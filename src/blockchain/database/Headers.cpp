@@ -44,6 +44,111 @@
 
 namespace opentxs::blockchain::database
 {
+auto Headers::BestChain::bytes(const block::Hash& hash) noexcept -> Bytes
+{
+    auto out = Bytes{};
+    const auto view = hash.Bytes();
+    std::memcpy(out.data(), view.data(), std::min(view.size(), out.size()));
+
+    return out;
+}
+
+auto Headers::BestChain::Clear() noexcept -> void
+{
+    hashes_.clear();
+    heights_.clear();
+}
+
+auto Headers::BestChain::Hash(const block::Height height) const noexcept
+    -> block::Hash
+{
+    if ((0 > height) || (Tip() < height)) { return {}; }
+
+    const auto& hash = hashes_[static_cast<std::size_t>(height)];
+
+    return ReadView{reinterpret_cast<const char*>(hash.data()), hash.size()};
+}
+
+auto Headers::BestChain::Hasher::operator()(const Bytes& data) const noexcept
+    -> std::size_t
+{
+    // NOTE block hashes are uniformly distributed so any eight bytes make a
+    // good hash
+    auto out = std::size_t{};
+    std::memcpy(&out, data.data(), sizeof(out));
+
+    return out;
+}
+
+auto Headers::BestChain::Height(const block::Hash& hash) const noexcept
+    -> block::Height
+{
+    if (const auto i = heights_.find(bytes(hash)); heights_.end() != i) {
+
+        return i->second;
+    } else {
+
+        return -1;
+    }
+}
+
+auto Headers::BestChain::Recent(
+    const std::size_t count,
+    alloc::Resource* alloc) const noexcept -> Vector<block::Hash>
+{
+    auto output = Vector<block::Hash>{alloc};
+    output.reserve(std::min(count, hashes_.size()));
+
+    for (auto height = Tip(); (0 <= height) && (output.size() < count);
+         --height) {
+        output.emplace_back(Hash(height));
+    }
+
+    return output;
+}
+
+auto Headers::BestChain::Set(const block::Position& position) noexcept -> void
+{
+    const auto& [height, hash] = position;
+
+    if (0 > height) { return; }
+
+    const auto index = static_cast<std::size_t>(height);
+    const auto value = bytes(hash);
+
+    if (index < hashes_.size()) {
+        auto& existing = hashes_[index];
+
+        if (auto i = heights_.find(existing);
+            (heights_.end() != i) && (height == i->second)) {
+            heights_.erase(i);
+        }
+
+        existing = value;
+    } else {
+        hashes_.resize(index + 1u);
+        hashes_.back() = value;
+    }
+
+    heights_[value] = height;
+}
+
+auto Headers::BestChain::Tip() const noexcept -> block::Height
+{
+    return static_cast<block::Height>(hashes_.size()) - 1;
+}
+
+auto Headers::BestChain::Truncate(const block::Height parent) noexcept -> void
+{
+    const auto size = static_cast<std::size_t>(std::max<block::Height>(
+        parent + 1, 0));
+
+    while (hashes_.size() > size) {
+        heights_.erase(hashes_.back());
+        hashes_.pop_back();
+    }
+}
+
 Headers::Headers(
     const api::Session& api,
     const node::internal::Network& network,
@@ -55,7 +160,13 @@ Headers::Headers(
     , common_(common)
     , lmdb_(lmdb)
     , lock_()
+    , index_()
 {
+    {
+        auto lock = Lock{lock_};
+        load_index(lock);
+    }
+
     import_genesis(type);
 
     {
@@ -218,6 +329,10 @@ auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
         return false;
     }
 
+    if (update.HaveReorg()) { index_.Truncate(update.ReorgParent().first); }
+
+    for (const auto& position : update.BestChain()) { index_.Set(position); }
+
     const auto position = best(lock);
     const auto& [height, hash] = position;
     const auto bytes = hash.Bytes();
@@ -252,28 +367,20 @@ auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
 auto Headers::BestBlock(const block::Height position) const noexcept(false)
     -> block::Hash
 {
-    auto output = block::Hash{};
-
-    if (0 > position) { return output; }
-
-    lmdb_.Load(
-        BlockHeaderBest,
-        tsv(static_cast<std::size_t>(position)),
-        [&](const auto in) -> void {
-            const auto rc = output.Assign(in.data(), in.size());
+    // TODO some callers which should be catching an exception for a missing
+    // height aren't. Clean up those call sites then start throwing
+    // std::out_of_range instead of returning a null hash.
+    Lock lock(lock_);
 
-            if (!rc) {
-                throw std::runtime_error("Database contains invalid hash");
-            }
-        });
+    return index_.Hash(position);
+}
 
-    if (output.IsNull()) {
-        // TODO some callers which should be catching this exception aren't.
-        // Clean up those call sites then start throwing this exception.
-        // throw std::out_of_range("No best hash at specified height");
-    }
+auto Headers::BestHeight(const block::Hash& hash) const noexcept
+    -> block::Height
+{
+    Lock lock(lock_);
 
-    return output;
+    return index_.Height(hash);
 }
 
 auto Headers::best() const noexcept -> block::Position
@@ -285,34 +392,11 @@ auto Headers::best() const noexcept -> block::Position
 
 auto Headers::best(const Lock& lock) const noexcept -> block::Position
 {
-    auto output = make_blank<block::Position>::value(api_);
-    auto height = std::size_t{0};
-
-    if (false ==
-        lmdb_.Load(
-            ChainData,
-            tsv(static_cast<std::size_t>(Key::TipHeight)),
-            [&](const auto in) -> void {
-                std::memcpy(
-                    &height, in.data(), std::min(in.size(), sizeof(height)));
-            })) {
+    const auto height = index_.Tip();
 
-        return make_blank<block::Position>::value(api_);
-    }
-
-    if (false ==
-        lmdb_.Load(BlockHeaderBest, tsv(height), [&](const auto in) -> void {
-            const auto rc = output.second.Assign(in.data(), in.size());
-
-            OT_ASSERT(rc);  // TODO exception
-        })) {
-
-        return make_blank<block::Position>::value(api_);
-    }
+    if (0 > height) { return make_blank<block::Position>::value(api_); }
 
-    output.first = height;
-
-    return output;
+    return {height, index_.Hash(height)};
 }
 
 auto Headers::checkpoint(const Lock& lock) const noexcept -> block::Position
@@ -463,6 +547,11 @@ auto Headers::import_genesis(const blockchain::Type type) const noexcept -> void
 
         OT_ASSERT(success);
 
+        {
+            auto lock = Lock{lock_};
+            index_.Set({0, hash});
+        }
+
         const auto best = this->best();
 
         OT_ASSERT(0 == best.first);
@@ -525,6 +614,39 @@ auto Headers::load_header(const block::Hash& hash) const
     return output;
 }
 
+auto Headers::load_index(const Lock& lock) const noexcept -> void
+{
+    index_.Clear();
+    lmdb_.Read(
+        BlockHeaderBest,
+        [&](const auto key, const auto value) -> bool {
+            auto height = std::size_t{0};
+            std::memcpy(
+                &height, key.data(), std::min(key.size(), sizeof(height)));
+            index_.Set({static_cast<block::Height>(height), value});
+
+            return true;
+        },
+        storage::lmdb::LMDB::Dir::Forward);
+    auto tip = std::size_t{0};
+    const auto haveTip = lmdb_.Load(
+        ChainData,
+        tsv(static_cast<std::size_t>(Key::TipHeight)),
+        [&](const auto in) -> void {
+            std::memcpy(&tip, in.data(), std::min(in.size(), sizeof(tip)));
+        });
+
+    if (haveTip) {
+        index_.Truncate(static_cast<block::Height>(tip));
+    } else {
+        index_.Clear();
+    }
+
+    LogVerbose()(OT_PRETTY_CLASS())("loaded ")(index_.Tip() + 1)(
+        " best chain hashes into memory")
+        .Flush();
+}
+
 auto Headers::pop_best(const std::size_t i, MDB_txn* parent) const noexcept
     -> bool
 {
@@ -566,17 +688,7 @@ auto Headers::RecentHashes(alloc::Resource* alloc) const noexcept
 auto Headers::recent_hashes(const Lock& lock, alloc::Resource* alloc)
     const noexcept -> Vector<block::Hash>
 {
-    auto output = Vector<block::Hash>{alloc};
-    lmdb_.Read(
-        BlockHeaderBest,
-        [&](const auto, const auto value) -> bool {
-            output.emplace_back(value);
-
-            return 100 > output.size();
-        },
-        storage::lmdb::LMDB::Dir::Backward);
-
-    return output;
+    return index_.Recent(100, alloc);
 }
 
 auto Headers::SiblingHashes() const noexcept -> node::Hashes
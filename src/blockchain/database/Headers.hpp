@@ -6,7 +6,9 @@
 #pragma once
 
 #include <boost/container/flat_set.hpp>
+#include <robin_hood.h>
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <iosfwd>
@@ -81,6 +83,9 @@ struct Headers {
 public:
     auto BestBlock(const block::Height position) const noexcept(false)
         -> block::Hash;
+    // Returns -1 if the hash is not part of the best chain
+    auto BestHeight(const block::Hash& hash) const noexcept -> block::Height;
+    auto BestPosition() const noexcept -> block::Position { return best(); }
     auto CurrentBest() const noexcept -> std::unique_ptr<block::Header>
     {
         return load_header(best().second);
@@ -119,11 +124,44 @@ public:
         const blockchain::Type type) noexcept;
 
 private:
+    /// Memory resident copy of the best chain table
+    ///
+    /// Hashes are stored as plain arrays indexed by height and the reverse
+    /// lookup is an open addressing table, so best chain queries neither
+    /// touch the database nor allocate.
+    class BestChain
+    {
+    public:
+        auto Hash(const block::Height height) const noexcept -> block::Hash;
+        auto Height(const block::Hash& hash) const noexcept -> block::Height;
+        auto Recent(const std::size_t count, alloc::Resource* alloc)
+            const noexcept -> Vector<block::Hash>;
+        auto Tip() const noexcept -> block::Height;
+
+        auto Clear() noexcept -> void;
+        auto Set(const block::Position& position) noexcept -> void;
+        auto Truncate(const block::Height parent) noexcept -> void;
+
+    private:
+        using Bytes = std::array<std::byte, 32>;
+
+        struct Hasher {
+            auto operator()(const Bytes& data) const noexcept -> std::size_t;
+        };
+
+        Vector<Bytes> hashes_{};
+        robin_hood::unordered_flat_map<Bytes, block::Height, Hasher>
+            heights_{};
+
+        static auto bytes(const block::Hash& hash) noexcept -> Bytes;
+    };
+
     const api::Session& api_;
     const node::internal::Network& network_;
     const common::Database& common_;
     const storage::lmdb::LMDB& lmdb_;
     mutable std::mutex lock_;
+    mutable BestChain index_;
 
     auto best() const noexcept -> block::Position;
     auto best(const Lock& lock) const noexcept -> block::Position;
@@ -136,6 +174,7 @@ private:
     // Throws std::out_of_range if the header does not exist
     auto load_header(const block::Hash& hash) const noexcept(false)
         -> std::unique_ptr<block::Header>;
+    auto load_index(const Lock& lock) const noexcept -> void;
     auto pop_best(const std::size_t i, MDB_txn* parent) const noexcept -> bool;
     auto push_best(
         const block::Position next,
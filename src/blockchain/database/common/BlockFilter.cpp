@@ -8,8 +8,10 @@
 #include "blockchain/database/common/BlockFilter.hpp"  // IWYU pragma: associated
 
 #include <google/protobuf/arena.h>  // IWYU pragma: keep
+#include <google/protobuf/io/coded_stream.h>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <mutex>
 #include <stdexcept>
@@ -98,12 +100,69 @@ auto BlockFilter::load_filter_index(
     if (0 == out.size_) { throw std::out_of_range("Cfilter not found"); }
 }
 
+auto BlockFilter::LoadEncodedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    const EncodedFilterCallback& cb) const noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+
+    if (false == bool(cb)) { return output; }
+
+    // Larger requests spill over to the heap
+    constexpr auto batch =
+        node::internal::FilterDatabase::encoded_filter_batch_;
+    constexpr auto allocBytes =
+        (batch * sizeof(util::IndexData)) + sizeof(Vector<util::IndexData>);
+    auto buf = std::array<std::byte, allocBytes>{};
+    auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
+    const auto reading = bulk_.StartRead();
+    const auto indices = [&] {
+        auto out = Vector<util::IndexData>{&alloc};
+        out.reserve(blocks.size());
+        auto tx = lmdb_.TransactionRO();
+
+        for (const auto& hash : blocks) {
+            try {
+                auto& index = out.emplace_back();
+                load_filter_index(type, hash.Bytes(), tx, index);
+            } catch (const std::exception& e) {
+                LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+                out.pop_back();
+
+                break;
+            }
+        }
+
+        return out;
+    }();
+
+    for (const auto& index : indices) {
+        try {
+            auto count = std::uint32_t{};
+            auto filter = ReadView{};
+            parse_encoded(bulk_.ReadView(index), count, filter);
+
+            if (false == cb(count, filter)) { break; }
+
+            ++output;
+        } catch (const std::exception& e) {
+            LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            break;
+        }
+    }
+
+    return output;
+}
+
 auto BlockFilter::LoadFilter(
     const cfilter::Type type,
     const ReadView blockHash,
     alloc::Default alloc) const noexcept -> opentxs::blockchain::GCS
 {
     try {
+        const auto reading = bulk_.StartRead();
         const auto index = [&] {
             auto out = util::IndexData{};
             load_filter_index(type, blockHash, out);
@@ -131,6 +190,7 @@ auto BlockFilter::LoadFilters(
         (1000u * sizeof(util::IndexData)) + sizeof(Vector<util::IndexData>);
     auto buf = std::array<std::byte, allocBytes>{};
     auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
+    const auto reading = bulk_.StartRead();
     const auto indices = [&] {
         auto out = Vector<util::IndexData>{&alloc};
         out.reserve(1000u);
@@ -229,6 +289,68 @@ auto BlockFilter::LoadFilterHeader(
     return output;
 }
 
+auto BlockFilter::parse_encoded(
+    const ReadView serialized,
+    std::uint32_t& count,
+    ReadView& filter) noexcept(false) -> void
+{
+    // NOTE this reads the count and filter fields of a serialized proto::GCS
+    // in place so the filter bytes do not have to be copied out of the
+    // memory mapped file.
+    namespace io = google::protobuf::io;
+    static constexpr auto countField = std::uint32_t{5};
+    static constexpr auto filterField = std::uint32_t{6};
+    static constexpr auto varint = std::uint32_t{0};
+    static constexpr auto bytes = std::uint32_t{2};
+    const auto* data = reinterpret_cast<const std::uint8_t*>(serialized.data());
+    auto stream =
+        io::CodedInputStream{data, static_cast<int>(serialized.size())};
+    auto haveCount{false};
+    auto haveFilter{false};
+
+    for (auto tag = stream.ReadTag(); 0u != tag; tag = stream.ReadTag()) {
+        const auto field = tag >> 3u;
+        const auto wire = tag & 0x7u;
+
+        if (varint == wire) {
+            auto value = std::uint64_t{};
+
+            if (false == stream.ReadVarint64(&value)) {
+                throw std::runtime_error{"truncated varint"};
+            }
+
+            if (countField == field) {
+                count = static_cast<std::uint32_t>(value);
+                haveCount = true;
+            }
+        } else if (bytes == wire) {
+            auto size = std::uint32_t{};
+
+            if (false == stream.ReadVarint32(&size)) {
+                throw std::runtime_error{"truncated length"};
+            }
+
+            const auto position =
+                static_cast<std::size_t>(stream.CurrentPosition());
+
+            if (false == stream.Skip(static_cast<int>(size))) {
+                throw std::runtime_error{"truncated field"};
+            }
+
+            if (filterField == field) {
+                filter = ReadView{serialized.data() + position, size};
+                haveFilter = true;
+            }
+        } else {
+            throw std::runtime_error{"unexpected wire type"};
+        }
+    }
+
+    if ((false == haveCount) || (false == haveFilter)) {
+        throw std::runtime_error{"incomplete serialized cfilter"};
+    }
+}
+
 auto BlockFilter::store(
     const Lock& lock,
     storage::lmdb::LMDB::Transaction& tx,
@@ -255,7 +377,7 @@ auto BlockFilter::store(
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(table, blockHash, cb);
+            lmdb_.Load(table, blockHash, cb, tx);
 
             return output;
         }();
@@ -435,7 +557,7 @@ auto BlockFilter::StoreFilters(
                 return true;
             };
             auto& [block, header, filter, bytes, index] = i;
-            lmdb_.Load(fTable, block, readIndex);
+            lmdb_.Load(fTable, block, readIndex, tx);
             auto view =
                 bulk_.WriteView(lock, tx, index, std::move(writeIndex), bytes);
 
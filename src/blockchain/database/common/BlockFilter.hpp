@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -74,6 +75,10 @@ public:
         const noexcept -> bool;
     auto HaveFilterHeader(const cfilter::Type type, const ReadView blockHash)
         const noexcept -> bool;
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterCallback& cb) const noexcept -> std::size_t;
     auto LoadFilter(
         const cfilter::Type type,
         const ReadView blockHash,
@@ -115,6 +120,10 @@ private:
     storage::lmdb::LMDB& lmdb_;
     Bulk& bulk_;
 
+    static auto parse_encoded(
+        const ReadView serialized,
+        std::uint32_t& count,
+        ReadView& filter) noexcept(false) -> void;
     static auto translate_filter(const cfilter::Type type) noexcept(false)
         -> Table;
     static auto translate_header(const cfilter::Type type) noexcept(false)
@@ -43,6 +43,7 @@ auto BlockHeader::Exists(
 auto BlockHeader::Load(const opentxs::blockchain::block::Hash& hash) const
     noexcept(false) -> proto::BlockchainBlockHeader
 {
+    const auto reading = bulk_.StartRead();
     const auto index = [&] {
         auto out = util::IndexData{};
         auto cb = [&out](const ReadView in) {
@@ -126,7 +127,7 @@ auto BlockHeader::store(
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(table_, hash.Bytes(), cb);
+            lmdb_.Load(table_, hash.Bytes(), cb, pTx);
 
             return output;
         }();
@@ -8,6 +8,7 @@
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <type_traits>
@@ -41,6 +42,7 @@ struct Blocks::Imp {
     auto Load(const Hash& block) const noexcept -> BlockReader
     {
         auto lock = Lock{lock_};
+        auto reading = bulk_.StartRead();
         auto index = util::IndexData{};
         auto cb = [&index](const auto in) {
             if (sizeof(index) != in.size()) { return; }
@@ -57,7 +59,13 @@ struct Blocks::Imp {
             return {};
         }
 
-        return BlockReader{bulk_.ReadView(index), block_locks_[block]};
+        // NOTE the space occupied by the block must not be reused while the
+        // view exists
+        return BlockReader{
+            bulk_.ReadView(index),
+            block_locks_[block],
+            [guard = std::make_shared<util::FileStorageReader>(
+                 std::move(reading))] {}};
     }
 
     auto Store(const Hash& block, const std::size_t bytes) const noexcept
@@ -73,6 +81,7 @@ struct Blocks::Imp {
             return {};
         }
 
+        auto tx = lmdb_.TransactionRW();
         auto index = [&] {
             auto output = util::IndexData{};
             auto cb = [&output](const auto in) {
@@ -80,7 +89,7 @@ struct Blocks::Imp {
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(table_, block.Bytes(), cb);
+            lmdb_.Load(table_, block.Bytes(), cb, tx);
 
             return output;
         }();
@@ -98,7 +107,6 @@ struct Blocks::Imp {
 
             return true;
         };
-        auto tx = lmdb_.TransactionRW();
         auto view = bulk_.WriteView(tx, index, std::move(cb), bytes);
 
         if (false == view.valid()) {
@@ -7,22 +7,48 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "blockchain/database/common/Bulk.hpp"  // IWYU pragma: associated
 
+#include <exception>
 #include <mutex>
 #include <utility>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Log.hpp"
 #include "util/MappedFileStorage.hpp"
 
 namespace opentxs::blockchain::database::common
 {
 struct Bulk::Imp final : private util::MappedFileStorage {
+    auto Compact(std::size_t limit) const noexcept -> std::size_t
+    {
+        try {
+            auto tx = lmdb_.TransactionRW();
+            auto lock = Lock{lock_};
+
+            return compact(tx, tables_, limit);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return 0;
+        }
+    }
     auto Mutex() const noexcept -> std::mutex& { return lock_; }
     auto ReadView(const Lock&, const util::IndexData& index) const noexcept
         -> opentxs::ReadView
     {
         return get_read_view(index);
     }
+    auto StartRead() const noexcept -> util::FileStorageReader
+    {
+        return start_read();
+    }
+    auto Stats() const noexcept -> util::FileStorageStats
+    {
+        auto lock = Lock{lock_};
+
+        return stats();
+    }
     auto WriteView(
         const Lock&,
         storage::lmdb::LMDB::Transaction& tx,
@@ -40,12 +66,23 @@ struct Bulk::Imp final : private util::MappedFileStorage {
               path,
               "blk",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextBlockAddress))
+              static_cast<std::size_t>(Database::Key::NextBlockAddress),
+              Table::BulkFreeSpace)
+        , tables_({
+              Table::BlockIndex,
+              Table::HeaderIndex,
+              Table::FilterIndexBasic,
+              Table::FilterIndexBCH,
+              Table::FilterIndexES,
+              Table::TransactionIndex,
+          })
         , lock_()
     {
     }
 
 private:
+    // NOTE every table whose values refer to an item in the block files
+    const IndexTables tables_;
     mutable std::mutex lock_;
 };
 
@@ -55,6 +92,11 @@ Bulk::Bulk(storage::lmdb::LMDB& lmdb, const UnallocatedCString& path) noexcept(
 {
 }
 
+auto Bulk::Compact(std::size_t limit) const noexcept -> std::size_t
+{
+    return imp_->Compact(limit);
+}
+
 auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
 
 auto Bulk::ReadView(const util::IndexData& index) const noexcept
@@ -71,6 +113,16 @@ auto Bulk::ReadView(const Lock& lock, const util::IndexData& index)
     return imp_->ReadView(lock, index);
 }
 
+auto Bulk::StartRead() const noexcept -> util::FileStorageReader
+{
+    return imp_->StartRead();
+}
+
+auto Bulk::Stats() const noexcept -> util::FileStorageStats
+{
+    return imp_->Stats();
+}
+
 auto Bulk::WriteView(
     storage::lmdb::LMDB::Transaction& tx,
     util::IndexData& index,
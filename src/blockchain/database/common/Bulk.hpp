@@ -30,6 +30,9 @@ class LMDB;
 
 namespace util
 {
+class FileStorageReader;
+
+struct FileStorageStats;
 struct IndexData;
 }  // namespace util
 // }  // namespace v1
@@ -44,11 +47,18 @@ public:
     using UpdateCallback =
         std::function<bool(storage::lmdb::LMDB::Transaction&)>;
 
+    // Relocate at most limit bytes of stored items into free space and reclaim
+    // free space at the end of the block files
+    auto Compact(std::size_t limit) const noexcept -> std::size_t;
     auto Mutex() const noexcept -> std::mutex&;
     auto ReadView(const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
     auto ReadView(const Lock& lock, const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
+    // Keep the returned object alive for as long as any view obtained from an
+    // index which was loaded after calling this function is in use
+    auto StartRead() const noexcept -> util::FileStorageReader;
+    auto Stats() const noexcept -> util::FileStorageStats;
     auto WriteView(
         storage::lmdb::LMDB::Transaction& tx,
         util::IndexData& index,
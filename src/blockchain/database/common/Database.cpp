@@ -13,12 +13,16 @@ extern "C" {
 }
 
 #include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>  // IWYU pragma: keep
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iosfwd>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
@@ -33,8 +37,14 @@ extern "C" {
 #include "blockchain/database/common/Sync.hpp"
 #include "blockchain/database/common/Wallet.hpp"
 #include "internal/api/Legacy.hpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "internal/util/TSV.hpp"
+#include "internal/util/Timer.hpp"
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"  // IWYU pragma: keep
 #include "opentxs/core/String.hpp"
@@ -43,7 +53,9 @@ extern "C" {
 #include "opentxs/util/Options.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "serialization/protobuf/BlockchainBlockHeader.pb.h"
+#include "util/ByteLiterals.hpp"
 #include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
 
 constexpr auto false_byte_ = std::byte{0x0};
 constexpr auto true_byte_ = std::byte{0x1};
@@ -53,7 +65,14 @@ namespace opentxs::blockchain::database::common
 struct Database::Imp {
     using SiphashKey = Space;
 
+    struct Compaction {
+        std::mutex lock_{};
+        bool running_{true};
+    };
+
     static const storage::lmdb::TableNames table_names_;
+    static constexpr auto compaction_interval_ = std::chrono::minutes{1};
+    static constexpr auto compaction_limit_ = std::size_t{64_MiB};
 
     const api::Session& api_;
     const api::Legacy& legacy_;
@@ -71,6 +90,8 @@ struct Database::Imp {
     Sync sync_;
     Wallet wallet_;
     Configuration config_;
+    std::shared_ptr<Compaction> compaction_;
+    Timer compaction_timer_;
 
     static auto block_storage_enabled() noexcept -> bool
     {
@@ -266,6 +287,21 @@ struct Database::Imp {
         return init_folder(legacy_, blockchain_path_, String::Factory(dir))
             ->Get();
     }
+    auto Compact(std::size_t limit) const noexcept -> std::size_t
+    {
+        return bulk_.Compact(limit) + sync_.Compact(limit);
+    }
+    auto Stats() const noexcept -> util::FileStorageStats
+    {
+        auto output = bulk_.Stats();
+        const auto sync = sync_.Stats();
+        output.live_bytes_ += sync.live_bytes_;
+        output.free_bytes_ += sync.free_bytes_;
+        output.pending_bytes_ += sync.pending_bytes_;
+        output.file_bytes_ += sync.file_bytes_;
+
+        return output;
+    }
 
     Imp(const api::Session& api,
         const api::crypto::Blockchain& blockchain,
@@ -303,6 +339,8 @@ struct Database::Imp {
                       {Table::FilterIndexBCH, 0},
                       {Table::FilterIndexES, 0},
                       {Table::TransactionIndex, 0},
+                      {Table::BulkFreeSpace, MDB_INTEGERKEY},
+                      {Table::SyncFreeSpace, MDB_INTEGERKEY},
                   };
 
                   for (const auto& [table, name] : SyncTables()) {
@@ -331,11 +369,45 @@ struct Database::Imp {
         , sync_(api_, lmdb_, blocks_path_->Get())
         , wallet_(api_, blockchain, lmdb_, bulk_)
         , config_(api_, lmdb_)
+        , compaction_(std::make_shared<Compaction>())
+        , compaction_timer_(api_.Network().Asio().Internal().GetTimer())
     {
         OT_ASSERT(crypto_shorthash_KEYBYTES == siphash_key_.size());
+        OT_ASSERT(compaction_);
 
         static_assert(
             sizeof(opentxs::blockchain::PatternID) == crypto_shorthash_BYTES);
+
+        schedule_compaction();
+    }
+
+    ~Imp()
+    {
+        {
+            auto lock = Lock{compaction_->lock_};
+            compaction_->running_ = false;
+        }
+
+        compaction_timer_.Cancel();
+    }
+
+private:
+    // NOTE free space is reclaimed a bounded amount at a time so the storage
+    // locks are never held for long. The shared state ensures a timer callback
+    // which is already running finishes before this object is destroyed.
+    auto schedule_compaction() noexcept -> void
+    {
+        compaction_timer_.SetRelative(compaction_interval_);
+        compaction_timer_.Wait([this, state = compaction_](const auto& ec) {
+            if (ec) { return; }
+
+            auto lock = Lock{state->lock_};
+
+            if (false == state->running_) { return; }
+
+            Compact(compaction_limit_);
+            schedule_compaction();
+        });
     }
 };
 
@@ -364,6 +436,8 @@ const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
         {Table::FilterIndexBCH, "block_filters_bch_2"},
         {Table::FilterIndexES, "block_filters_opentxs_2"},
         {Table::TransactionIndex, "transactions"},
+        {Table::BulkFreeSpace, "block_storage_free_space"},
+        {Table::SyncFreeSpace, "sync_storage_free_space"},
     };
 
     for (const auto& [table, name] : SyncTables()) {
@@ -435,6 +509,11 @@ auto Database::BlockStore(const BlockHash& block, const std::size_t bytes)
     return imp_.blocks_.Store(block, bytes);
 }
 
+auto Database::CompactStorage(std::size_t limit) const noexcept -> std::size_t
+{
+    return imp_.Compact(limit);
+}
+
 auto Database::DeleteSyncServer(
     const UnallocatedCString& endpoint) const noexcept -> bool
 {
@@ -510,6 +589,14 @@ auto Database::LoadBlockHeader(const BlockHash& hash) const noexcept(false)
     return imp_.headers_.Load(hash);
 }
 
+auto Database::LoadEncodedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    const EncodedFilterCallback& cb) const noexcept -> std::size_t
+{
+    return imp_.filters_.LoadEncodedFilters(type, blocks, cb);
+}
+
 auto Database::LoadFilter(
     const cfilter::Type type,
     const ReadView blockHash,
@@ -606,6 +693,11 @@ auto Database::ReorgSync(const Chain chain, const Height height) const noexcept
     return imp_.sync_.Reorg(chain, height);
 }
 
+auto Database::StorageStats() const noexcept -> util::FileStorageStats
+{
+    return imp_.Stats();
+}
+
 auto Database::StoreBlockHeader(
     const opentxs::blockchain::block::Header& header) const noexcept -> bool
 {
@@ -76,6 +76,11 @@ class Data;
 }  // namespace p2p
 }  // namespace network
 
+namespace util
+{
+struct FileStorageStats;
+}  // namespace util
+
 class Contact;
 class Data;
 class Options;
@@ -123,6 +128,9 @@ public:
     auto BlockPolicy() const noexcept -> BlockStorage;
     auto BlockStore(const BlockHash& block, const std::size_t bytes)
         const noexcept -> BlockWriter;
+    // Relocate at most limit bytes of stored items into free space in each of
+    // the block and sync files. This also runs periodically in the background.
+    auto CompactStorage(std::size_t limit) const noexcept -> std::size_t;
     auto DeleteSyncServer(const UnallocatedCString& endpoint) const noexcept
         -> bool;
     auto Disable(const Chain type) const noexcept -> bool;
@@ -143,6 +151,10 @@ public:
     auto LoadBlockHeader(const BlockHash& hash) const noexcept(false)
         -> proto::BlockchainBlockHeader;
     auto LoadEnabledChains() const noexcept -> UnallocatedVector<EnabledChain>;
+    auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterCallback& cb) const noexcept -> std::size_t;
     auto LoadFilter(
         const cfilter::Type type,
         const ReadView blockHash,
@@ -170,6 +182,8 @@ public:
         -> UnallocatedVector<pTxid>;
     auto ReorgSync(const Chain chain, const Height height) const noexcept
         -> bool;
+    // Space used by the block and sync files
+    auto StorageStats() const noexcept -> util::FileStorageStats;
     auto StoreBlockHeader(const opentxs::blockchain::block::Header& header)
         const noexcept -> bool;
     auto StoreBlockHeaders(const UpdatedHeader& headers) const noexcept -> bool;
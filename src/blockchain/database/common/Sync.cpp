@@ -48,12 +48,36 @@ extern "C" {
 namespace opentxs::blockchain::database::common
 {
 struct Sync::Imp final : private util::MappedFileStorage {
+    auto Compact(std::size_t limit) const noexcept -> std::size_t
+    {
+        try {
+            auto lock = ExclusiveLock{lock_};
+            auto tx = lmdb_.TransactionRW();
+            const auto tables = [] {
+                auto out = IndexTables{};
+
+                for (const auto& [table, name] : SyncTables()) {
+                    out.emplace_back(table);
+                }
+
+                return out;
+            }();
+
+            return compact(tx, tables, limit);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return 0;
+        }
+    }
     auto Load(const Chain chain, const Height height, Message& output)
         const noexcept -> bool
     {
         const auto start = static_cast<std::size_t>(height + 1);
         auto haveOne{false};
         auto total = std::size_t{};
+        // NOTE views are only used while this lock is held, which excludes
+        // every operation that releases or reuses space
         auto lock = SharedLock{lock_};
         const auto cb = [&](const auto key, const auto value) {
             if ((nullptr == key.data()) ||
@@ -228,6 +252,12 @@ struct Sync::Imp final : private util::MappedFileStorage {
         return true;
     }
 
+    auto Stats() const noexcept -> util::FileStorageStats
+    {
+        auto lock = SharedLock{lock_};
+
+        return stats();
+    }
     auto Tip(const Chain chain) const noexcept -> Height
     {
         auto lock = SharedLock{lock_};
@@ -248,7 +278,8 @@ struct Sync::Imp final : private util::MappedFileStorage {
               path,
               "sync",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextSyncAddress))
+              static_cast<std::size_t>(Database::Key::NextSyncAddress),
+              Table::SyncFreeSpace)
         , api_(api)
         , tip_table_(Table::SyncTips)
         , lock_()
@@ -399,8 +430,17 @@ private:
         const auto table = ChainToSyncTable(chain);
 
         for (auto key = Height{height + 1}; key <= tip; ++key) {
-            if (false ==
-                lmdb_.Delete(table, static_cast<std::size_t>(key), txn)) {
+            const auto dbKey = static_cast<std::size_t>(key);
+            auto cb = [&](const auto in) {
+                try {
+                    release(txn, Data{in}.index_);
+                } catch (const std::exception& e) {
+                    LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                }
+            };
+            lmdb_.Load(table, tsv(dbKey), cb, txn);
+
+            if (false == lmdb_.Delete(table, dbKey, txn)) {
                 LogError()(OT_PRETTY_CLASS())("Delete error").Flush();
 
                 return false;
@@ -437,6 +477,11 @@ Sync::Sync(
 {
 }
 
+auto Sync::Compact(std::size_t limit) const noexcept -> std::size_t
+{
+    return imp_->Compact(limit);
+}
+
 auto Sync::Load(const Chain chain, const Height height, Message& output)
     const noexcept -> bool
 {
@@ -453,6 +498,11 @@ auto Sync::Store(const Chain chain, const Items& items) const noexcept -> bool
     return imp_->Store(chain, items);
 }
 
+auto Sync::Stats() const noexcept -> util::FileStorageStats
+{
+    return imp_->Stats();
+}
+
 auto Sync::Tip(const Chain chain) const noexcept -> Height
 {
     return imp_->Tip(chain);
@@ -54,6 +54,11 @@ namespace lmdb
 class LMDB;
 }  // namespace lmdb
 }  // namespace storage
+
+namespace util
+{
+struct FileStorageStats;
+}  // namespace util
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
@@ -69,10 +74,14 @@ public:
     using Message = opentxs::network::p2p::Data;
     using Items = UnallocatedVector<Block>;
 
+    // Relocate at most limit bytes of stored items into free space and reclaim
+    // free space at the end of the sync files
+    auto Compact(std::size_t limit) const noexcept -> std::size_t;
     auto Load(const Chain chain, const Height height, Message& output)
         const noexcept -> bool;
     // Delete all entries with a height greater than specified
     auto Reorg(const Chain chain, const Height height) const noexcept -> bool;
+    auto Stats() const noexcept -> util::FileStorageStats;
     auto Store(const Chain chain, const Items& items) const noexcept -> bool;
     auto Tip(const Chain chain) const noexcept -> Height;
 
@@ -118,6 +118,7 @@ auto Wallet::LoadTransaction(const ReadView txid) const noexcept
     -> std::unique_ptr<block::bitcoin::Transaction>
 {
     try {
+        const auto reading = bulk_.StartRead();
         const auto proto = [&] {
             const auto index = [&] {
                 auto out = util::IndexData{};
@@ -187,6 +188,7 @@ auto Wallet::StoreTransaction(
         }();
         const auto& hash = proto.txid();
         const auto bytes = proto.ByteSizeLong();
+        auto dLock = lmdb_.TransactionRW();
         auto index = [&] {
             auto output = util::IndexData{};
             auto cb = [&output](const ReadView in) {
@@ -194,7 +196,7 @@ auto Wallet::StoreTransaction(
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(transaction_table_, hash, cb);
+            lmdb_.Load(transaction_table_, hash, cb, dLock);
 
             return output;
         }();
@@ -212,7 +214,6 @@ auto Wallet::StoreTransaction(
 
             return true;
         };
-        auto dLock = lmdb_.TransactionRW();
         auto view = [&] {
             auto bLock = Lock{bulk_.Mutex()};
 
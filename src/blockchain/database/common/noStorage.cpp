@@ -8,6 +8,8 @@
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 #include "blockchain/database/common/Sync.hpp"    // IWYU pragma: associated
 
+#include "util/MappedFileStorage.hpp"
+
 namespace opentxs::blockchain::database::common
 {
 struct Blocks::Imp {
@@ -43,6 +45,8 @@ Sync::Sync(
 {
 }
 
+auto Sync::Compact(std::size_t) const noexcept -> std::size_t { return {}; }
+
 auto Sync::Load(const Chain chain, const Height height, Message& output)
     const noexcept -> bool
 {
@@ -59,6 +63,8 @@ auto Sync::Store(const Chain chain, const Items& items) const noexcept -> bool
     return {};
 }
 
+auto Sync::Stats() const noexcept -> util::FileStorageStats { return {}; }
+
 auto Sync::Tip(const Chain chain) const noexcept -> Height { return -1; }
 
 Sync::~Sync() = default;
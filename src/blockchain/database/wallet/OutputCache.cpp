@@ -650,14 +650,8 @@ auto OutputCache::populate() noexcept -> void
 
     OT_ASSERT(rc);
 
-    rc = lmdb_.Read(wallet::positions_, positions, fwd, tx);
-
-    OT_ASSERT(rc);
-
-    rc = lmdb_.Read(wallet::states_, states, fwd, tx);
-
-    OT_ASSERT(rc);
-
+    lmdb_.ReadFixed(wallet::positions_, positions, tx);
+    lmdb_.ReadFixed(wallet::states_, states, tx);
     rc = lmdb_.Read(wallet::subchains_, subchains, fwd, tx);
 
     OT_ASSERT(rc);
@@ -56,6 +56,7 @@ HeaderOracle::HeaderOracle(
     , database_(database)
     , chain_(type)
     , lock_()
+    , generation_(0)
 {
     auto lock = Lock{lock_};
     const auto best = best_chain(lock);
@@ -160,7 +161,7 @@ auto HeaderOracle::AddCheckpoint(
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -181,23 +182,42 @@ auto HeaderOracle::AddHeaders(
 {
     if (0 == headers.size()) { return false; }
 
-    auto lock = Lock{lock_};
-    auto update = UpdateTransaction{api_, database_};
-
-    for (auto& header : headers) {
+    // NOTE proof of work was verified when the headers were instantiated.
+    // Batches may be disconnected, contain several branches, or arrive out of
+    // order so each header is connected individually below.
+    for (const auto& header : headers) {
         if (false == bool(header)) {
             LogError()(OT_PRETTY_CLASS())("Invalid header").Flush();
 
             return false;
         }
+    }
 
-        if (false == add_header(lock, update, std::move(header))) {
+    // NOTE the headers are connected to the chain and the candidates are
+    // evaluated without holding lock_, reading chain state through the
+    // database which synchronizes each read. If another update was applied
+    // in the meantime the staged update may be based on a stale view of the
+    // chain so it is discarded and the batch is staged again under the lock.
+    const auto generation = generation_.load();
+
+    {
+        auto update = UpdateTransaction{api_, database_};
+        const auto unlocked = Lock{lock_, std::defer_lock};
+        const auto staged = stage_headers(unlocked, headers, update);
+        auto lock = Lock{lock_};
 
-            return false;
+        if (staged && (generation == generation_.load())) {
+
+            return apply_update(lock, update);
         }
     }
 
-    return database_.ApplyUpdate(update);
+    auto lock = Lock{lock_};
+    auto update = UpdateTransaction{api_, database_};
+
+    if (false == stage_headers(lock, headers, update)) { return false; }
+
+    return apply_update(lock, update);
 }
 
 auto HeaderOracle::add_header(
@@ -304,10 +324,20 @@ auto HeaderOracle::apply_checkpoint(
     }
 }
 
+auto HeaderOracle::apply_update(
+    const Lock& lock,
+    const UpdateTransaction& update) noexcept -> bool
+{
+    const auto output = database_.ApplyUpdate(update);
+    ++generation_;
+
+    return output;
+}
+
 auto HeaderOracle::best_chain(const Lock& lock) const noexcept
     -> block::Position
 {
-    return database_.CurrentBest()->Position();
+    return database_.BestPosition();
 }
 
 auto HeaderOracle::BestChain() const noexcept -> block::Position
@@ -715,7 +745,7 @@ auto HeaderOracle::DeleteCheckpoint() noexcept -> bool
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -906,13 +936,9 @@ auto HeaderOracle::is_disconnected(
 auto HeaderOracle::is_in_best_chain(const Lock& lock, const block::Hash& hash)
     const noexcept -> std::pair<bool, block::Height>
 {
-    const auto pHeader = database_.TryLoadHeader(hash);
-
-    if (false == bool(pHeader)) { return {false, -1}; }
+    const auto height = database_.BestHeight(hash);
 
-    const auto& header = *pHeader;
-
-    return {is_in_best_chain(lock, header.Height(), hash), header.Height()};
+    return {0 <= height, height};
 }
 
 auto HeaderOracle::is_in_best_chain(
@@ -954,6 +980,7 @@ auto HeaderOracle::ProcessSyncData(
     const network::p2p::Data& data) noexcept -> std::size_t
 {
     auto output = std::size_t{0};
+    auto lock = Lock{lock_};
     auto update = UpdateTransaction{api_, database_};
 
     try {
@@ -963,7 +990,6 @@ auto HeaderOracle::ProcessSyncData(
             std::runtime_error{"No blocks in sync data"};
         }
 
-        auto lock = Lock{lock_};
         auto previous = [&]() -> block::Hash {
             const auto& first = blocks.front();
             const auto height = first.Height();
@@ -1010,7 +1036,7 @@ auto HeaderOracle::ProcessSyncData(
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
     }
 
-    if ((0u < output) && database_.ApplyUpdate(update)) {
+    if ((0u < output) && apply_update(lock, update)) {
         OT_ASSERT(output == hashes.size());
 
         return output;
@@ -1020,6 +1046,21 @@ auto HeaderOracle::ProcessSyncData(
     }
 }
 
+auto HeaderOracle::stage_headers(
+    const Lock& lock,
+    const UnallocatedVector<std::unique_ptr<block::Header>>& headers,
+    UpdateTransaction& update) noexcept -> bool
+{
+    for (const auto& header : headers) {
+        if (false == add_header(lock, update, header->clone())) {
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
 auto HeaderOracle::stage_candidate(
     const Lock& lock,
     const block::Header& best,
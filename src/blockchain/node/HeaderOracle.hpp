@@ -6,6 +6,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
@@ -172,6 +173,9 @@ private:
     internal::HeaderDatabase& database_;
     const blockchain::Type chain_;
     mutable std::mutex lock_;
+    // NOTE incremented each time an update is applied to the database. An
+    // update staged without lock_ is only applied if this is unchanged.
+    std::atomic<std::size_t> generation_;
 
     static auto evaluate_candidate(
         const block::Header& current,
@@ -215,6 +219,9 @@ private:
         const Lock& lock,
         const block::Height height,
         UpdateTransaction& update) noexcept -> bool;
+    auto apply_update(
+        const Lock& lock,
+        const UpdateTransaction& update) noexcept -> bool;
     auto choose_candidate(
         const block::Header& current,
         const Candidates& candidates,
@@ -242,6 +249,10 @@ private:
     auto is_disconnected(
         const block::Hash& parent,
         UpdateTransaction& update) noexcept -> const block::Header*;
+    auto stage_headers(
+        const Lock& lock,
+        const UnallocatedVector<std::unique_ptr<block::Header>>& headers,
+        UpdateTransaction& update) noexcept -> bool;
     auto stage_candidate(
         const Lock& lock,
         const block::Header& best,
@@ -34,6 +34,7 @@ UpdateTransaction::UpdateTransaction(
     , delete_sib_()
     , connect_()
     , disconnected_()
+    , cached_checkpoint_()
     , cached_disconnected_()
     , cached_siblings_()
 {
@@ -62,8 +63,11 @@ auto UpdateTransaction::Checkpoint() const -> block::Position
 
         return checkpoint_;
     } else {
+        if (false == cached_checkpoint_.has_value()) {
+            cached_checkpoint_ = db_.CurrentCheckpoint();
+        }
 
-        return db_.CurrentCheckpoint();
+        return cached_checkpoint_.value();
     }
 }
 
@@ -109,6 +109,7 @@ private:
     Hashes delete_sib_;
     Segments connect_;
     Segments disconnected_;
+    mutable std::optional<block::Position> cached_checkpoint_;
     mutable std::optional<DisconnectedList> cached_disconnected_;
     mutable std::optional<Hashes> cached_siblings_;
 
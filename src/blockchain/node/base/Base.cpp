@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstddef>
 #include <iomanip>
 #include <iosfwd>
 #include <iterator>
@@ -91,12 +92,16 @@
 #include "serialization/protobuf/BlockchainTransactionProposedOutput.pb.h"
 #include "serialization/protobuf/HDPath.pb.h"
 #include "serialization/protobuf/PaymentCode.pb.h"
+#include "util/Parallel.hpp"
 
 namespace opentxs::blockchain::node::implementation
 {
 constexpr auto proposal_version_ = VersionNumber{1};
 constexpr auto notification_version_ = VersionNumber{1};
 constexpr auto output_version_ = VersionNumber{1};
+// NOTE instantiating a header hashes it and checks its proof of work, so a
+// full headers message is split into jobs of this size
+constexpr auto headers_per_job_ = std::size_t{250};
 
 struct NullWallet final : public node::internal::Wallet {
     const api::Session& api_;
@@ -815,10 +820,17 @@ auto Base::process_header(network::zeromq::Message&& in) noexcept -> void
     }
 
     auto headers = UnallocatedVector<std::unique_ptr<block::Header>>{};
-
-    for (const auto& header : input) {
-        headers.emplace_back(instantiate_header(header));
-    }
+    headers.resize(input.size());
+    const auto count = input.size();
+    const auto jobs = (count + headers_per_job_ - 1u) / headers_per_job_;
+    RunParallel(api_, ThreadPool::Blockchain, jobs, [&](const auto job) {
+        const auto first = job * headers_per_job_;
+        const auto last = std::min(first + headers_per_job_, count);
+
+        for (auto i = first; i < last; ++i) {
+            headers[i] = instantiate_header(input[i]);
+        }
+    });
 
     if (false == headers.empty()) { header_.AddHeaders(headers); }
 
@@ -645,19 +645,22 @@ auto FilterOracle::process_block(
 {
     const auto& id = block.ID();
     const auto params = blockchain::internal::GetFilterParams(filterType);
-    const auto elements = [&] {
+    auto elements = Vector<OTData>{};
+
+    try {
         const auto input = block.Internal().ExtractElements(filterType);
-        auto output = Vector<OTData>{};
         std::transform(
             input.begin(),
             input.end(),
-            std::back_inserter(output),
+            std::back_inserter(elements),
             [&](const auto& element) -> OTData {
                 return api_.Factory().DataFromBytes(reader(element));
             });
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
-        return output;
-    }();
+        return {};
+    }
 
     return factory::GCS(
         api_,
@@ -19,6 +19,7 @@
 #include <iterator>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
@@ -200,7 +201,6 @@ public:
     }
 
     PrehashData(
-        const api::Session& api,
         const BlockTargets& targets,
         const std::string_view name,
         wallet::MatchCache::Results& results,
@@ -208,7 +208,6 @@ public:
         std::size_t jobs,
         allocator_type alloc) noexcept
         : job_count_(jobs)
-        , api_(api)
         , targets_(targets)
         , name_(name)
         , data_(alloc)
@@ -251,7 +250,6 @@ private:
         TxoData>;
     using Data = Vector<BlockData>;
 
-    const api::Session& api_;
     const BlockTargets& targets_;
     const std::string_view name_;
     Data data_;
@@ -278,12 +276,13 @@ private:
             blockchain::internal::BlockHashToFilterKey(block.Bytes());
         const auto& [indices, bytes] = targets;
         auto& [hashes, map] = dest;
+        const auto computed = gcs::SiphashBatch(key, bytes, {});
         auto i = indices.cbegin();
-        auto t = bytes.cbegin();
+        auto h = computed.cbegin();
         auto end = indices.cend();
 
-        for (; i < end; ++i, ++t) {
-            auto& hash = hashes.emplace_back(gcs::Siphash(api_, key, *t));
+        for (; i < end; ++i, ++h) {
+            auto& hash = hashes.emplace_back(*h);
             map[hash].emplace_back(&(*i));
         }
 
@@ -300,12 +299,40 @@ private:
         wallet::MatchCache::Index& results) const noexcept -> void
     {
         const auto alloc = results.get_allocator();
-        const auto GetKeys = [&](const auto& data) {
+        const auto& [height, p20, p32, p33, p64, p65, pTxo] = prehashed;
+        const auto matched = cfilter.Internal().Match(
+            blockchain::internal::GCS::PrehashedTargets{
+                {&p20.first,
+                 &p32.first,
+                 &p33.first,
+                 &p64.first,
+                 &p65.first,
+                 &pTxo.first},
+                alloc});
+        auto& [clean, dirty, sizes] = cache;
+
+        if (false == matched.has_value()) {
+            // NOTE a filter which can not be decoded can not rule out any
+            // element so the block itself must be scanned
+            LogError()(OT_PRETTY_CLASS())(name_)(
+                " failed to decode cfilter for block ")(print(position))
+                .Flush();
+            dirty.emplace(position);
+            sizes.emplace(position.first, cfilter.ElementCount());
+
+            return;
+        }
+
+        const auto& hits = matched.value();
+
+        OT_ASSERT(6u == hits.size());
+
+        const auto GetKeys = [&](const auto& data, const auto& found) {
             auto out = Set<Bip32Index>{alloc};
             const auto& [hashes, map] = data;
             const auto start = hashes.cbegin();
 
-            for (const auto& match : cfilter.Internal().Match(hashes)) {
+            for (const auto& match : found) {
                 const auto dist = std::distance(start, match);
 
                 OT_ASSERT(0 <= dist);
@@ -317,12 +344,12 @@ private:
 
             return out;
         };
-        const auto GetOutpoints = [&](const auto& data) {
+        const auto GetOutpoints = [&](const auto& data, const auto& found) {
             auto out = Set<block::Outpoint>{alloc};
             const auto& [hashes, map] = data;
             const auto start = hashes.cbegin();
 
-            for (const auto& match : cfilter.Internal().Match(hashes)) {
+            for (const auto& match : found) {
                 const auto dist = std::distance(start, match);
 
                 OT_ASSERT(0 <= dist);
@@ -336,11 +363,12 @@ private:
         };
         const auto GetResults = [&](const auto& cb,
                                     const auto& prehashed,
+                                    const auto& found,
                                     const auto& selected,
                                     auto& clean,
                                     auto& dirty,
                                     auto& output) {
-            const auto matches = cb(prehashed);
+            const auto matches = cb(prehashed, found);
 
             for (const auto& index : selected.first) {
                 if (0u == matches.count(index)) {
@@ -354,12 +382,12 @@ private:
             output.second += selected.first.size();
         };
         const auto& selected = targets.second;
-        const auto& [height, p20, p32, p33, p64, p65, pTxo] = prehashed;
         const auto& [s20, s32, s33, s64, s65, sTxo] = selected;
         auto output = std::pair<std::size_t, std::size_t>{};
         GetResults(
             GetKeys,
             p20,
+            hits.at(0),
             s20,
             results.confirmed_no_match_.match_20_,
             results.confirmed_match_.match_20_,
@@ -367,6 +395,7 @@ private:
         GetResults(
             GetKeys,
             p32,
+            hits.at(1),
             s32,
             results.confirmed_no_match_.match_32_,
             results.confirmed_match_.match_32_,
@@ -374,6 +403,7 @@ private:
         GetResults(
             GetKeys,
             p33,
+            hits.at(2),
             s33,
             results.confirmed_no_match_.match_33_,
             results.confirmed_match_.match_33_,
@@ -381,6 +411,7 @@ private:
         GetResults(
             GetKeys,
             p64,
+            hits.at(3),
             s64,
             results.confirmed_no_match_.match_64_,
             results.confirmed_match_.match_64_,
@@ -388,6 +419,7 @@ private:
         GetResults(
             GetKeys,
             p65,
+            hits.at(4),
             s65,
             results.confirmed_no_match_.match_65_,
             results.confirmed_match_.match_65_,
@@ -395,6 +427,7 @@ private:
         GetResults(
             GetOutpoints,
             pTxo,
+            hits.at(5),
             sTxo,
             results.confirmed_no_match_.match_txo_,
             results.confirmed_match_.match_txo_,
@@ -403,7 +436,6 @@ private:
         log(OT_PRETTY_CLASS())(name_)(" GCS ")(procedure)(" for block ")(
             print(position))(" matched ")(count)(" of ")(of)(" target elements")
             .Flush();
-        auto& [clean, dirty, sizes] = cache;
 
         if (0u == count) {
             clean.emplace(position);
@@ -1185,7 +1217,6 @@ auto SubchainStateData::scan(
             select_targets(*handle, blocks, elements, startHeight, selected);
             auto results = wallet::MatchCache::Results{get_allocator()};
             auto prehash = PrehashData{
-                api_,
                 selected,
                 name_,
                 results,
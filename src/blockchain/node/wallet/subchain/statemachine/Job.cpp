@@ -130,7 +130,12 @@ Job::Job(
 
               return out;
           }(),
-          std::move(neverDrop))
+          std::move(neverDrop),
+          {
+              // NOTE only the most recent filter tip for a given chain and
+              // filter type is relevant
+              {Work::filter, {CoalesceMode::latest, 2u}},
+          })
     , parent_p_(parent)
     , parent_(*parent_p_)
     , job_type_(type)
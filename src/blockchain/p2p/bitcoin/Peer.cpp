@@ -215,6 +215,8 @@ Peer::Peer(
           get_local_services(protocol_, chain_, policy, localServices))
     , relay_(relay)
     , get_headers_()
+    , cfilter_queue_()
+    , cfilter_pending_(false)
 {
     init();
 }
@@ -1048,6 +1050,16 @@ auto Peer::process_getcfilters(
         return;
     }
 
+    if (cfilter_queue_.size() > cfilter_queue_limit_) {
+        log_()("Disconnecting ")(display_chain_)(" peer ")(address_.Display())(
+            " due to excessive pending cfilter requests (")(
+            cfilter_queue_.size())(")")
+            .Flush();
+        disconnect();
+
+        return;
+    }
+
     const auto& message = *pMessage;
     const auto& stopHash = message.Stop();
     const auto pStopHeader = headers_.LoadHeader(stopHash);
@@ -1094,49 +1106,23 @@ auto Peer::process_getcfilters(
         return;
     }
 
-    // TODO allocator
-    auto data = Vector<GCS>{};
-    data.reserve(count);
-    const auto& filters = network_.FilterOracle();
     const auto type = message.Type();
     const auto hashes = headers_.BestHashes(startHeight, stopHash);
 
-    for (const auto& hash : hashes) {
-        const auto& cfilter = data.emplace_back(
-            filters.LoadFilter(type, hash, data.get_allocator()));
-
-        if (false == cfilter.IsValid()) { break; }
-    }
-
-    if (data.size() != count) {
+    if (hashes.size() != count) {
         LogError()(OT_PRETTY_CLASS())(
-            "Failed to load all filters, requested (")(count)("), loaded (")(
-            data.size())(")")
+            "Failed to load all block hashes, requested (")(count)(
+            "), loaded (")(hashes.size())(")")
             .Flush();
 
         return;
     }
 
-    OT_ASSERT(data.size() == hashes.size());
-
-    auto h{hashes.begin()};
-
-    for (auto g{data.begin()}; g != data.end(); ++g, ++h) {
-        auto pOut = std::unique_ptr<message::internal::Cfilter>{
-            factory::BitcoinP2PCfilter(api_, chain_, type, *h, *g)};
-
-        if (false == bool(pOut)) {
-            LogError()(OT_PRETTY_CLASS())("Failed to construct reply").Flush();
-
-            return;
-        }
-
-        log_("sending cfilter message to ")(display_chain_)(" peer ")(
-            address_.Display())
-            .Flush();
-        const auto& message = *pOut;
-        send(message.Transmit());
+    for (const auto& hash : hashes) {
+        cfilter_queue_.emplace_back(type, hash);
     }
+
+    if (false == cfilter_pending_) { send_cfilters(); }
 }
 
 auto Peer::process_getdata(
@@ -2220,6 +2206,66 @@ auto Peer::request_transactions(
     send(message.Transmit());
 }
 
+auto Peer::send_cfilters() noexcept -> void
+{
+    // NOTE the filters are copied directly from storage into the outgoing
+    // frames. Only cfilter_window_ messages are queued at a time: the next
+    // batch is loaded when the SendCfilters task reaches the front of the
+    // pipeline, which happens after the previous batch has been transmitted.
+    cfilter_pending_ = false;
+
+    if (cfilter_queue_.empty()) { return; }
+
+    const auto type = cfilter_queue_.front().first;
+    auto hashes = Vector<block::Hash>{};
+    hashes.reserve(std::min(cfilter_window_, cfilter_queue_.size()));
+
+    while ((hashes.size() < cfilter_window_) &&
+           (false == cfilter_queue_.empty()) &&
+           (type == cfilter_queue_.front().first)) {
+        hashes.emplace_back(std::move(cfilter_queue_.front().second));
+        cfilter_queue_.pop_front();
+    }
+
+    auto h{hashes.begin()};
+    const auto sent = filter_.LoadEncodedFilters(
+        type, hashes, [&](const auto count, const auto compressed) {
+            auto frames = factory::BitcoinP2PCfilterFrames(
+                api_, chain_, type, *h, count, compressed);
+
+            if (0u == frames.first.size()) {
+                LogError()(OT_PRETTY_CLASS())("Failed to construct reply")
+                    .Flush();
+
+                return false;
+            }
+
+            log_("sending cfilter message to ")(display_chain_)(" peer ")(
+                address_.Display())
+                .Flush();
+            send(std::move(frames));
+            ++h;
+
+            return true;
+        });
+
+    if (sent != hashes.size()) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Failed to load all filters, requested (")(hashes.size())(
+            "), loaded (")(sent)(")")
+            .Flush();
+        // NOTE the remainder of the request can not be served either
+        cfilter_queue_.clear();
+
+        return;
+    }
+
+    if (false == cfilter_queue_.empty()) {
+        cfilter_pending_ = true;
+        pipeline_.Push(MakeWork(Task::SendCfilters));
+    }
+}
+
 auto Peer::start_handshake() noexcept -> void
 {
     try {
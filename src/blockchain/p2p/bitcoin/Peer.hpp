@@ -12,6 +12,7 @@
 #include <iosfwd>
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 #include "blockchain/p2p/bitcoin/Header.hpp"
 #include "blockchain/p2p/bitcoin/Message.hpp"
@@ -148,6 +149,15 @@ private:
         Time start_{};
     };
 
+    using CfilterQueue =
+        UnallocatedDeque<std::pair<cfilter::Type, block::Hash>>;
+
+    // Maximum number of cfilter messages queued for transmission at once
+    static constexpr auto cfilter_window_ =
+        node::internal::FilterDatabase::encoded_filter_batch_;
+    // Peers which send getcfilters while more than this many filters from
+    // their earlier requests are still queued are disconnected
+    static constexpr auto cfilter_queue_limit_ = 4u * cfilter_window_;
     static const UnallocatedMap<Command, CommandFunction> command_map_;
     static const ProtocolVersion default_protocol_version_{70015};
     static const UnallocatedCString user_agent_;
@@ -158,6 +168,8 @@ private:
     const UnallocatedSet<p2p::Service> local_services_;
     std::atomic<bool> relay_;
     Request get_headers_;
+    CfilterQueue cfilter_queue_;
+    bool cfilter_pending_;
 
     static auto get_local_services(
         const ProtocolVersion version,
@@ -197,6 +209,7 @@ private:
     auto request_mempool() noexcept -> void final;
     auto request_transactions(
         UnallocatedVector<blockchain::bitcoin::Inventory>&&) noexcept -> void;
+    auto send_cfilters() noexcept -> void final;
     auto start_handshake() noexcept -> void final;
 
     auto process_addr(
@@ -22,9 +22,12 @@
 #include "internal/blockchain/p2p/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/blockchain/p2p/Types.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+#include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 
@@ -132,6 +135,64 @@ auto BitcoinP2PCfilter(
         return out;
     }());
 }
+
+auto BitcoinP2PCfilterFrames(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const blockchain::cfilter::Type type,
+    const blockchain::block::Hash& hash,
+    const std::uint32_t count,
+    const ReadView compressed) noexcept -> std::pair<zmq::Frame, zmq::Frame>
+{
+    namespace bitcoin = blockchain::p2p::bitcoin;
+    using BitcoinFormat =
+        bitcoin::message::implementation::Cfilter::BitcoinFormat;
+    using CompactSize = network::blockchain::bitcoin::CompactSize;
+
+    try {
+        auto output = std::pair<zmq::Frame, zmq::Frame>{};
+        auto& [header, payload] = output;
+        const auto elements = CompactSize(count).Encode();
+        const auto filterBytes = elements.size() + compressed.size();
+        const auto size = CompactSize(filterBytes).Encode();
+        static constexpr auto fixed = sizeof(BitcoinFormat);
+        const auto bytes = fixed + size.size() + filterBytes;
+        auto out = payload.WriteInto()(bytes);
+
+        if (false == out.valid(bytes)) {
+            throw std::runtime_error{"failed to allocate output space"};
+        }
+
+        const auto data = BitcoinFormat{chain, type, hash};
+        auto* i = out.as<std::byte>();
+        std::memcpy(i, static_cast<const void*>(&data), fixed);
+        std::advance(i, fixed);
+        std::memcpy(i, size.data(), size.size());
+        std::advance(i, size.size());
+        std::memcpy(i, elements.data(), elements.size());
+        std::advance(i, elements.size());
+        std::memcpy(i, compressed.data(), compressed.size());
+        auto checksum = Data::Factory();
+
+        if (false == P2PMessageHash(
+                         api, chain, payload.Bytes(), checksum->WriteInto())) {
+            throw std::runtime_error{"failed to calculate checksum"};
+        }
+
+        const auto serialized = bitcoin::Header{
+            api, chain, bitcoin::Command::cfilter, bytes, std::move(checksum)};
+
+        if (false == serialized.Serialize(header.WriteInto())) {
+            throw std::runtime_error{"failed to serialize header"};
+        }
+
+        return output;
+    } catch (const std::exception& e) {
+        LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
+
+        return {};
+    }
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::blockchain::p2p::bitcoin::message::implementation
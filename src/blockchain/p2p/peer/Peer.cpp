@@ -426,6 +426,9 @@ auto Peer::pipeline(zmq::Message&& message) noexcept -> void
         case Task::SendMessage: {
             transmit(std::move(message));
         } break;
+        case Task::SendCfilters: {
+            send_cfilters();
+        } break;
         case Task::Init: {
             connection_->on_init(std::move(message));
         } break;
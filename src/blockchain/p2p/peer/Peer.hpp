@@ -299,6 +299,7 @@ protected:
     auto reset_cfheader_job() noexcept -> void;
     auto reset_cfilter_job() noexcept -> void;
     auto send(std::pair<zmq::Frame, zmq::Frame>&& data) noexcept -> SendStatus;
+    virtual auto send_cfilters() noexcept -> void = 0;
     auto update_address_services(
         const UnallocatedSet<p2p::Service>& services) noexcept -> void;
     auto verifying() noexcept -> bool
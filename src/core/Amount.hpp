@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include <boost/config.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/endian/buffers.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <limits>
 #include <memory>
@@ -24,8 +26,80 @@
 
 namespace be = boost::endian;
 
+namespace opentxs::amount
+{
+// NOTE compilers which provide a native 128 bit integer and overflow checking
+// builtins get a fast path for values which fit in 128 bits. Everything else
+// uses the arbitrary precision backend for every operation.
+#if defined(BOOST_HAS_INT128) && defined(__GNUC__)
+using Small = boost::int128_type;
+using SmallUnsigned = boost::uint128_type;
+static constexpr auto have_small_{true};
+#else
+using Small = std::int64_t;
+using SmallUnsigned = std::uint64_t;
+static constexpr auto have_small_{false};
+#endif
+
+static constexpr auto small_max_{
+    static_cast<Small>(static_cast<SmallUnsigned>(~SmallUnsigned{0}) >> 1u)};
+static constexpr auto small_min_{-small_max_ - 1};
+static constexpr auto small_scale_{[] {
+    if constexpr (have_small_) {
+
+        return Small{1} << fractional_bits_;
+    } else {
+
+        return Small{1};
+    }
+}()};
+
+template <typename T>
+auto checked_add(const Small lhs, const T rhs, Small& out) noexcept -> bool
+{
+#if defined(BOOST_HAS_INT128) && defined(__GNUC__)
+    return false == __builtin_add_overflow(lhs, rhs, &out);
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+auto checked_multiply(const Small lhs, const T rhs, Small& out) noexcept
+    -> bool
+{
+#if defined(BOOST_HAS_INT128) && defined(__GNUC__)
+    return false == __builtin_mul_overflow(lhs, rhs, &out);
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+auto checked_subtract(const Small lhs, const T rhs, Small& out) noexcept
+    -> bool
+{
+#if defined(BOOST_HAS_INT128) && defined(__GNUC__)
+    return false == __builtin_sub_overflow(lhs, rhs, &out);
+#else
+    return false;
+#endif
+}
+
+/// Equivalent to Imp::shift_left for values which fit in a Small
+template <typename T>
+auto small_shift_left(const T amount, Small& out) noexcept -> bool
+{
+    return have_small_ && checked_multiply(small_scale_, amount, out);
+}
+}  // namespace opentxs::amount
+
 namespace opentxs
 {
+/// Fixed point amount with fractional_bits_ of precision. Values which fit in
+/// a native 128 bit integer are stored and operated on directly and promoted
+/// to the checked arbitrary precision backend only when a result would
+/// overflow, so results are identical regardless of representation.
 class Amount::Imp final : virtual public internal::Amount
 {
 public:
@@ -46,66 +120,120 @@ public:
     {
         return extract_int<std::uint64_t>();
     }
-    auto operator<(const Imp& rhs) const { return amount_ < rhs.amount_; }
+    auto operator<(const Imp& rhs) const
+    {
+        if (small() && rhs.small()) { return small_ < rhs.small_; }
+
+        return value() < rhs.value();
+    }
 
     template <typename T>
     auto operator<(const T rhs) const
     {
-        return amount_ < shift_left(rhs);
+        auto shifted = amount::Small{};
+
+        if (small() && amount::small_shift_left(rhs, shifted)) {
+
+            return small_ < shifted;
+        }
+
+        return value() < shift_left(rhs);
     }
-    auto operator>(const Imp& rhs) const { return amount_ > rhs.amount_; }
+    auto operator>(const Imp& rhs) const { return rhs < *this; }
 
     template <typename T>
     auto operator>(const T rhs) const
     {
-        return amount_ > shift_left(rhs);
+        auto shifted = amount::Small{};
+
+        if (small() && amount::small_shift_left(rhs, shifted)) {
+
+            return small_ > shifted;
+        }
+
+        return value() > shift_left(rhs);
     }
 
-    auto operator==(const Imp& rhs) const { return amount_ == rhs.amount_; }
+    auto operator==(const Imp& rhs) const
+    {
+        if (small() && rhs.small()) { return small_ == rhs.small_; }
+
+        return value() == rhs.value();
+    }
 
     template <typename T>
     auto operator==(const T rhs) const
     {
-        return amount_ == shift_left(rhs);
+        auto shifted = amount::Small{};
+
+        if (small() && amount::small_shift_left(rhs, shifted)) {
+
+            return small_ == shifted;
+        }
+
+        return value() == shift_left(rhs);
     }
 
-    auto operator!=(const Imp& rhs) const { return amount_ != rhs.amount_; }
+    auto operator!=(const Imp& rhs) const { return false == (*this == rhs); }
 
     template <typename T>
     auto operator!=(const T rhs) const
     {
-        return amount_ != shift_left(rhs);
+        return false == (*this == rhs);
     }
 
-    auto operator<=(const Imp& rhs) const { return amount_ <= rhs.amount_; }
+    auto operator<=(const Imp& rhs) const { return false == (rhs < *this); }
 
     template <typename T>
     auto operator<=(const T rhs) const
     {
-        return amount_ <= shift_left(rhs);
+        return false == (*this > rhs);
     }
 
-    auto operator>=(const Imp& rhs) const { return amount_ >= rhs.amount_; }
+    auto operator>=(const Imp& rhs) const { return false == (*this < rhs); }
 
     template <typename T>
     auto operator>=(const T rhs) const
     {
-        return amount_ >= shift_left(rhs);
+        return false == (*this < rhs);
     }
 
     auto operator+(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ + rhs.amount_;
+        auto out = amount::Small{};
+
+        if (small() && rhs.small() &&
+            amount::checked_add(small_, rhs.small_, out)) {
+
+            return Imp{Native{}, out};
+        }
+
+        return value() + rhs.value();
     }
 
     auto operator-(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ - rhs.amount_;
+        auto out = amount::Small{};
+
+        if (small() && rhs.small() &&
+            amount::checked_subtract(small_, rhs.small_, out)) {
+
+            return Imp{Native{}, out};
+        }
+
+        return value() - rhs.value();
     }
 
     auto operator*(const Imp& rhs) const noexcept(false) -> Imp
     {
-        const auto total = amount_ * rhs.amount_;
+        auto out = amount::Small{};
+
+        if (small() && rhs.small() && multiply(rhs, out)) {
+
+            return Imp{Native{}, out};
+        }
+
+        const auto total = value() * rhs.value();
         auto imp = Imp{total};
         return imp.shift_right();
     }
@@ -113,59 +241,120 @@ public:
     template <typename T>
     auto operator*(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ * rhs;
+        auto out = amount::Small{};
+
+        if (small() && amount::checked_multiply(small_, rhs, out)) {
+
+            return Imp{Native{}, out};
+        }
+
+        return value() * rhs;
     }
 
     auto operator/(const Imp& rhs) const noexcept(false) -> Imp
     {
-        const auto total = amount_ / rhs.amount_;
+        auto out = amount::Small{};
+
+        if (small() && rhs.small() && divisible(rhs.small_) &&
+            amount::small_shift_left(small_ / rhs.small_, out)) {
+
+            return Imp{Native{}, out};
+        }
+
+        const auto total = value() / rhs.value();
         return Imp::shift_left(total);
     }
 
     template <typename T>
     auto operator/(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ / rhs;
+        const auto divisor = static_cast<amount::Small>(rhs);
+
+        if (small() && divisible(divisor)) {
+
+            return Imp{Native{}, small_ / divisor};
+        }
+
+        return value() / rhs;
     }
 
     auto operator%(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ % rhs.amount_;
+        if (small() && rhs.small() && divisible(rhs.small_)) {
+
+            return Imp{Native{}, small_ % rhs.small_};
+        }
+
+        return value() % rhs.value();
     }
 
     template <typename T>
     auto operator%(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ % shift_left(rhs);
+        auto shifted = amount::Small{};
+
+        if (small() && amount::small_shift_left(rhs, shifted) &&
+            divisible(shifted)) {
+
+            return Imp{Native{}, small_ % shifted};
+        }
+
+        return value() % shift_left(rhs);
     }
 
     auto operator*=(const Imp& amount) noexcept(false) -> Imp&
     {
-        auto total = amount_ * amount.amount_;
-        amount_ = Imp(total).shift_right();
+        const auto product = *this * amount;
+        *this = product;
         return *this;
     }
 
     auto operator+=(const Imp& amount) noexcept(false) -> Imp&
     {
-        amount_ += amount.amount_;
+        auto out = amount::Small{};
+
+        if (small() && amount.small() &&
+            amount::checked_add(small_, amount.small_, out)) {
+            small_ = out;
+
+            return *this;
+        }
+
+        set(value() + amount.value());
         return *this;
     }
 
     auto operator-=(const Imp& amount) noexcept(false) -> Imp&
     {
-        amount_ -= amount.amount_;
+        auto out = amount::Small{};
+
+        if (small() && amount.small() &&
+            amount::checked_subtract(small_, amount.small_, out)) {
+            small_ = out;
+
+            return *this;
+        }
+
+        set(value() - amount.value());
         return *this;
     }
 
-    auto operator-() -> Imp { return -amount_; }
+    auto operator-() -> Imp
+    {
+        if (small() && (amount::small_min_ != small_)) {
+
+            return Imp{Native{}, -small_};
+        }
+
+        return -value();
+    }
 
     auto Serialize(const AllocateOutput dest) const noexcept -> bool
     {
         auto amount = UnallocatedCString{};
 
         try {
-            amount = amount_.str();
+            amount = value().str();
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())("Error serializing amount: ")(
                 e.what())
@@ -179,19 +368,34 @@ public:
     auto SerializeBitcoin(const AllocateOutput dest) const noexcept
         -> bool final
     {
-        const auto backend = shift_right();
-        if (backend < 0 || backend > std::numeric_limits<std::int64_t>::max())
-            return false;
-
         auto amount = std::int64_t{};
-        try {
-            amount = backend.convert_to<std::int64_t>();
-        } catch (const std::exception& e) {
-            LogError()(OT_PRETTY_CLASS())("Error serializing bitcoin amount: ")(
-                e.what())
-                .Flush();
-            return false;
+
+        if (small()) {
+            const auto backend = small_ / amount::small_scale_;
+
+            if ((backend < 0) ||
+                (backend > std::numeric_limits<std::int64_t>::max())) {
+
+                return false;
+            }
+
+            amount = static_cast<std::int64_t>(backend);
+        } else {
+            const auto backend = shift_right();
+            if (backend < 0 ||
+                backend > std::numeric_limits<std::int64_t>::max())
+                return false;
+
+            try {
+                amount = backend.convert_to<std::int64_t>();
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Error serializing bitcoin amount: ")(e.what())
+                    .Flush();
+                return false;
+            }
         }
+
         const auto buffer = be::little_int64_buf_t(amount);
 
         const auto view =
@@ -204,12 +408,22 @@ public:
 
     auto ToFloat() const noexcept -> amount::Float final
     {
-        return amount::IntegerToFloat(amount_);
+        return amount::IntegerToFloat(value());
     }
 
     template <typename T>
     auto extract_int() const noexcept -> T
     {
+        if constexpr (amount::have_small_) {
+            const auto whole = small_ / amount::small_scale_;
+
+            if (small() && (whole >= std::numeric_limits<T>::min()) &&
+                (whole <= std::numeric_limits<T>::max())) {
+
+                return static_cast<T>(whole);
+            }
+        }
+
         try {
             return shift_right().convert_to<T>();
         } catch (const std::exception& e) {
@@ -224,7 +438,7 @@ public:
     auto extract_float() const noexcept -> T
     {
         try {
-            return amount_.convert_to<T>() / shift_left(1).convert_to<T>();
+            return value().convert_to<T>() / shift_left(1).convert_to<T>();
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())("Error converting Amount to float: ")(
                 e.what())
@@ -247,52 +461,72 @@ public:
 
     auto shift_right() const -> amount::Integer
     {
-        if (amount_ < 0) {
-            auto tmp = -amount_;
+        const auto amount = value();
+
+        if (amount < 0) {
+            auto tmp = -amount;
             tmp >>= amount::fractional_bits_;
             return -tmp;
         } else {
-            return amount_ >> amount::fractional_bits_;
+            return amount >> amount::fractional_bits_;
         }
     }
 
     Imp() noexcept
-        : amount_{}
+        : big_(false == amount::have_small_)
+        , small_{}
+        , amount_{}
     {
     }
     Imp(const amount::Integer& rhs) noexcept
-        : amount_{rhs}
+        : Imp()
     {
+        set(rhs);
     }
     Imp(amount::Integer&& rhs) noexcept
-        : amount_{std::move(rhs)}
+        : Imp()
     {
+        set(std::move(rhs));
     }
     Imp(long long amount) noexcept
-        : amount_{shift_left(amount)}
+        : Imp()
     {
+        if (false == amount::small_shift_left(amount, small_)) {
+            set(shift_left(amount));
+        }
     }
 
     Imp(unsigned long long amount) noexcept
-        : amount_{shift_left(amount)}
+        : Imp()
     {
+        if (false == amount::small_shift_left(amount, small_)) {
+            set(shift_left(amount));
+        }
     }
     Imp(std::string_view str, bool normalize = false) noexcept(false)
-        : amount_{amount::Integer{str}}
+        : Imp()
     {
+        auto amount = amount::Integer{str};
+
         if (normalize) {
-            if (amount_ < 0) {
-                amount_ = -(-amount_ << amount::fractional_bits_);
+            if (amount < 0) {
+                amount = -(-amount << amount::fractional_bits_);
             } else {
-                amount_ <<= amount::fractional_bits_;
+                amount <<= amount::fractional_bits_;
             }
         }
+
+        set(std::move(amount));
     }
     Imp(const Imp&) noexcept = default;
     Imp(Imp&& rhs) noexcept = delete;
     auto operator=(const Imp& imp) -> Imp&
     {
-        amount_ = imp.amount_;
+        big_ = imp.big_;
+        small_ = imp.small_;
+
+        if (big_) { amount_ = imp.amount_; }
+
         return *this;
     }
     auto operator=(Imp&& rhs) -> Imp& = delete;
@@ -300,6 +534,71 @@ public:
     ~Imp() final = default;
 
 private:
+    struct Native {};
+
+    bool big_;
+    amount::Small small_;
     amount::Integer amount_;
+
+    static auto fits(const amount::Integer& rhs) noexcept -> bool
+    {
+        static const auto max = amount::Integer{amount::small_max_};
+        static const auto min = amount::Integer{amount::small_min_};
+
+        return amount::have_small_ && (rhs >= min) && (rhs <= max);
+    }
+
+    auto divisible(const amount::Small rhs) const noexcept -> bool
+    {
+        if (0 == rhs) { return false; }
+
+        return (amount::small_min_ != small_) || (-1 != rhs);
+    }
+    auto multiply(const Imp& rhs, amount::Small& out) const noexcept -> bool
+    {
+        // NOTE the product of two fixed point values must be shifted right
+        // after multiplying, which would overflow for most operands. If either
+        // operand has no fractional component the shifted result can be
+        // calculated exactly without a wider intermediate value.
+        if (0 == (rhs.small_ % amount::small_scale_)) {
+
+            return amount::checked_multiply(
+                small_, rhs.small_ / amount::small_scale_, out);
+        } else if (0 == (small_ % amount::small_scale_)) {
+
+            return amount::checked_multiply(
+                rhs.small_, small_ / amount::small_scale_, out);
+        }
+
+        return false;
+    }
+    auto set(const amount::Integer& rhs) noexcept -> void
+    {
+        if (fits(rhs)) {
+            big_ = false;
+            small_ = rhs.convert_to<amount::Small>();
+        } else {
+            big_ = true;
+            amount_ = rhs;
+        }
+    }
+    auto small() const noexcept -> bool { return false == big_; }
+    auto value() const noexcept -> amount::Integer
+    {
+        if (big_) {
+
+            return amount_;
+        } else {
+
+            return amount::Integer{small_};
+        }
+    }
+
+    Imp(Native, const amount::Small rhs) noexcept
+        : big_(false)
+        , small_(rhs)
+        , amount_{}
+    {
+    }
 };
 }  // namespace opentxs
@@ -8,6 +8,7 @@
 #include "opentxs/interface/qt/Model.hpp"  // IWYU pragma: associated
 
 #include <QByteArray>
+#include <QVector>
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
@@ -39,12 +40,23 @@ struct Model::Imp {
         return ptr->index();
     }
 
+    auto BeginBatch() noexcept -> void
+    {
+        auto lock = Lock{parent_lock_};
+        ++batch_;
+    }
     auto ChangeRow(ui::internal::Row* parent, ui::internal::Row* row) noexcept
         -> void
     {
         auto lock = Lock{parent_lock_};
 
-        if (nullptr != parent_) { get_helper().requestChangeRow(parent, row); }
+        if (nullptr != parent_) {
+            if (0u < batch_) {
+                pending_.Change(parent, row);
+            } else {
+                get_helper().requestChangeRow(parent, row);
+            }
+        }
     }
     auto ClearParent() noexcept -> void
     {
@@ -56,7 +68,11 @@ struct Model::Imp {
         auto lock = Lock{parent_lock_};
 
         if (nullptr != parent_) {
-            get_helper().requestDeleteRow(row);
+            if (0u < batch_) {
+                pending_.Delete(row);
+            } else {
+                get_helper().requestDeleteRow(row);
+            }
         } else {
             do_delete_row(lock, row);
         }
@@ -82,6 +98,14 @@ struct Model::Imp {
         auto lock = Lock{data_lock_};
         do_move_row(lock, newParent, newBefore, row);
     }
+    auto EndBatch() noexcept -> void
+    {
+        auto lock = Lock{parent_lock_};
+
+        OT_ASSERT(0u < batch_);
+
+        if (0u == --batch_) { flush(lock); }
+    }
     auto GetChild(const ui::internal::Row* parent, int index) const noexcept
         -> ui::internal::Row*
     {
@@ -190,7 +214,11 @@ struct Model::Imp {
         auto lock = Lock{parent_lock_};
 
         if (nullptr != parent_) {
-            get_helper().requestInsertRow(parent, after, row);
+            if (0u < batch_) {
+                pending_.Insert(parent, after, std::move(row));
+            } else {
+                get_helper().requestInsertRow(parent, after, row);
+            }
         } else {
             do_insert_row(lock, parent, after, row);
         }
@@ -203,7 +231,11 @@ struct Model::Imp {
         auto lock = Lock{parent_lock_};
 
         if (nullptr != parent_) {
-            get_helper().requestMoveRow(newParent, newBefore, row);
+            if (0u < batch_) {
+                pending_.Move(newParent, newBefore, row);
+            } else {
+                get_helper().requestMoveRow(newParent, newBefore, row);
+            }
         } else {
             do_move_row(lock, newParent, newBefore, row);
         }
@@ -240,6 +272,8 @@ struct Model::Imp {
         , parent_(nullptr)
         , role_data_()
         , map_()
+        , batch_(0)
+        , pending_()
     {
         map_[ID(nullptr)];
     }
@@ -341,6 +375,8 @@ private:
     std::atomic<qt::Model*> parent_;
     RoleData role_data_;
     UnallocatedMap<RowID, RowData> map_;
+    std::size_t batch_;
+    RowQueue pending_;
 
     auto do_delete_row(const Lock&, const ui::internal::Row* item) noexcept
         -> void
@@ -416,6 +452,49 @@ private:
                 .Flush();
         }
     }
+    auto flush(const Lock&) noexcept -> void
+    {
+        auto operations = pending_.Take();
+
+        if (nullptr == parent_) { return; }
+
+        auto& helper = get_helper();
+
+        for (auto& op : operations) {
+            switch (op.type_) {
+                case RowQueue::Op::change: {
+                    helper.requestChangeRow(op.parent_, op.rows_.front());
+                } break;
+                case RowQueue::Op::insert: {
+                    auto rows = QVector<RowWrapper>{};
+                    rows.reserve(static_cast<int>(op.inserted_.size()));
+
+                    for (auto& row : op.inserted_) {
+                        rows.push_back(RowWrapper{std::move(row)});
+                    }
+
+                    helper.requestInsertRows(
+                        op.parent_, op.after_, std::move(rows));
+                } break;
+                case RowQueue::Op::move: {
+                    helper.requestMoveRow(
+                        op.parent_, op.after_, op.rows_.front());
+                } break;
+                case RowQueue::Op::remove: {
+                    auto rows = QVector<ui::internal::Row*>{};
+                    rows.reserve(static_cast<int>(op.rows_.size()));
+                    std::copy(
+                        op.rows_.begin(),
+                        op.rows_.end(),
+                        std::back_inserter(rows));
+                    helper.requestDeleteRows(std::move(rows));
+                } break;
+                default: {
+                    OT_FAIL;
+                }
+            }
+        }
+    }
     auto get_column_count(const Lock& lock, const ui::internal::Row* item)
         const noexcept -> int
     {
@@ -462,10 +541,17 @@ Model::Model(QObject* parent) noexcept
 {
     static const auto wrapperType = qRegisterMetaType<RowWrapper>();
     static const auto pointerType = qRegisterMetaType<ui::internal::Row*>();
+    static const auto wrappersType = qRegisterMetaType<QVector<RowWrapper>>();
+    static const auto pointersType =
+        qRegisterMetaType<QVector<ui::internal::Row*>>();
     LogInsane()(OT_PRETTY_CLASS())("wrapperType: ")(wrapperType).Flush();
     LogInsane()(OT_PRETTY_CLASS())("pointerType: ")(pointerType).Flush();
+    LogInsane()(OT_PRETTY_CLASS())("wrappersType: ")(wrappersType).Flush();
+    LogInsane()(OT_PRETTY_CLASS())("pointersType: ")(pointersType).Flush();
 }
 
+auto Model::BeginBatch() noexcept -> void { imp_->BeginBatch(); }
+
 auto Model::ChangeRow(
     ui::internal::Row* parent,
     ui::internal::Row* row) noexcept -> void
@@ -485,6 +571,8 @@ auto Model::do_delete_row(ui::internal::Row* row) noexcept -> void
     imp_->do_delete_row(row);
 }
 
+auto Model::EndBatch() noexcept -> void { imp_->EndBatch(); }
+
 auto Model::do_insert_row(
     ui::internal::Row* parent,
     ui::internal::Row* after,
@@ -632,12 +720,24 @@ ModelHelper::ModelHelper(Model* model) noexcept
         model,
         &Model::deleteRow,
         Qt::QueuedConnection);
+    connect(
+        this,
+        &ModelHelper::deleteRows,
+        model,
+        &Model::deleteRows,
+        Qt::QueuedConnection);
     connect(
         this,
         &ModelHelper::insertRow,
         model,
         &Model::insertRow,
         Qt::QueuedConnection);
+    connect(
+        this,
+        &ModelHelper::insertRows,
+        model,
+        &Model::insertRows,
+        Qt::QueuedConnection);
     connect(
         this,
         &ModelHelper::moveRow,
@@ -658,6 +758,12 @@ auto ModelHelper::requestDeleteRow(ui::internal::Row* row) noexcept -> void
     emit deleteRow(row);
 }
 
+auto ModelHelper::requestDeleteRows(QVector<ui::internal::Row*> rows) noexcept
+    -> void
+{
+    emit deleteRows(std::move(rows));
+}
+
 auto ModelHelper::requestInsertRow(
     ui::internal::Row* parent,
     ui::internal::Row* after,
@@ -666,6 +772,14 @@ auto ModelHelper::requestInsertRow(
     emit insertRow(parent, after, std::move(row));
 }
 
+auto ModelHelper::requestInsertRows(
+    ui::internal::Row* parent,
+    ui::internal::Row* after,
+    QVector<RowWrapper> rows) noexcept -> void
+{
+    emit insertRows(parent, after, std::move(rows));
+}
+
 auto ModelHelper::requestMoveRow(
     ui::internal::Row* newParent,
     ui::internal::Row* newBefore,
@@ -745,6 +859,42 @@ auto Model::deleteRow(ui::internal::Row* item) noexcept -> void
     }
 }
 
+auto Model::deleteRows(QVector<ui::internal::Row*> rows) noexcept -> void
+{
+    if (nullptr == internal_) { return; }
+
+    using Rows = UnallocatedMap<int, ui::internal::Row*>;
+    auto parents = UnallocatedMap<ui::internal::Row*, Rows>{};
+
+    for (auto* row : rows) {
+        const auto index = internal_->GetIndex(row);
+
+        if (false == index.valid_) { continue; }
+
+        parents[internal_->GetParent(row).ptr_].emplace(index.row_, row);
+    }
+
+    for (auto& [parent, children] : parents) {
+        const auto ancestor = make_index(internal_->GetIndex(parent));
+        auto positions = UnallocatedVector<int>{};
+        positions.reserve(children.size());
+
+        for (const auto& [position, row] : children) {
+            positions.emplace_back(position);
+        }
+
+        for (const auto& [first, last] : ContiguousRuns(std::move(positions))) {
+            beginRemoveRows(ancestor, first, last);
+
+            for (auto i = first; i <= last; ++i) {
+                internal_->do_delete_row(children.at(i));
+            }
+
+            endRemoveRows();
+        }
+    }
+}
+
 auto Model::insertRow(
     ui::internal::Row* parent,
     ui::internal::Row* after,
@@ -765,6 +915,31 @@ auto Model::insertRow(
     }
 }
 
+auto Model::insertRows(
+    ui::internal::Row* parent,
+    ui::internal::Row* after,
+    QVector<RowWrapper> rows) noexcept -> void
+{
+    if ((nullptr != internal_) && (false == rows.empty())) {
+        const auto ancestor = make_index(internal_->GetIndex(parent));
+        const auto pos = [&] {
+            if (nullptr == after) { return 0; }
+
+            return internal_->GetIndex(after).row_ + 1;
+        }();
+        beginInsertRows(ancestor, pos, pos + rows.size() - 1);
+        auto* previous = after;
+
+        for (auto& wrapper : rows) {
+            auto* row = wrapper.row_.get();
+            internal_->do_insert_row(parent, previous, wrapper.row_);
+            previous = row;
+        }
+
+        endInsertRows();
+    }
+}
+
 auto Model::moveRow(
     ui::internal::Row* newParent,
     ui::internal::Row* newBefore,
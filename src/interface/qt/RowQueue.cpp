@@ -0,0 +1,114 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                  // IWYU pragma: associated
+#include "1_Internal.hpp"                // IWYU pragma: associated
+#include "internal/interface/ui/UI.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::ui::qt::internal
+{
+auto ContiguousRuns(UnallocatedVector<int> positions) noexcept
+    -> UnallocatedVector<std::pair<int, int>>
+{
+    auto output = UnallocatedVector<std::pair<int, int>>{};
+    std::sort(positions.begin(), positions.end(), std::greater<>{});
+    positions.erase(
+        std::unique(positions.begin(), positions.end()), positions.end());
+
+    for (const auto position : positions) {
+        if ((false == output.empty()) &&
+            (output.back().first == (position + 1))) {
+            output.back().first = position;
+        } else {
+            output.emplace_back(position, position);
+        }
+    }
+
+    return output;
+}
+
+RowQueue::Operation::Operation(
+    const Op type,
+    ui::internal::Row* parent,
+    ui::internal::Row* after) noexcept
+    : type_(type)
+    , parent_(parent)
+    , after_(after)
+    , rows_()
+    , inserted_()
+{
+}
+
+auto RowQueue::Change(
+    ui::internal::Row* parent,
+    ui::internal::Row* row) noexcept -> void
+{
+    if (false == changed_.emplace(row).second) { return; }
+
+    queue_.emplace_back(Op::change, parent, nullptr).rows_.emplace_back(row);
+}
+
+auto RowQueue::Delete(ui::internal::Row* row) noexcept -> void
+{
+    changed_.erase(row);
+
+    if (queue_.empty() || (Op::remove != queue_.back().type_)) {
+        queue_.emplace_back(Op::remove, nullptr, nullptr);
+    }
+
+    queue_.back().rows_.emplace_back(row);
+}
+
+auto RowQueue::Insert(
+    ui::internal::Row* parent,
+    ui::internal::Row* after,
+    std::shared_ptr<ui::internal::Row> row) noexcept -> void
+{
+    if ((false == queue_.empty()) && (Op::insert == queue_.back().type_) &&
+        (parent == queue_.back().parent_)) {
+        auto& range = queue_.back();
+
+        // NOTE a row inserted directly after the last row of the range extends
+        // it, and a row inserted after the anchor of the range is placed at
+        // its start
+        if (after == range.inserted_.back().get()) {
+            range.inserted_.emplace_back(std::move(row));
+
+            return;
+        } else if (after == range.after_) {
+            range.inserted_.emplace_front(std::move(row));
+
+            return;
+        }
+    }
+
+    queue_.emplace_back(Op::insert, parent, after)
+        .inserted_.emplace_back(std::move(row));
+}
+
+auto RowQueue::Move(
+    ui::internal::Row* newParent,
+    ui::internal::Row* newBefore,
+    ui::internal::Row* row) noexcept -> void
+{
+    queue_.emplace_back(Op::move, newParent, newBefore).rows_.emplace_back(row);
+}
+
+auto RowQueue::Take() noexcept -> Operations
+{
+    auto output = Operations{};
+    output.swap(queue_);
+    changed_.clear();
+
+    return output;
+}
+}  // namespace opentxs::ui::qt::internal
@@ -180,12 +180,16 @@ auto List::MakeQT(const api::Session&) noexcept -> ui::qt::internal::Model*
 
 namespace opentxs::ui::qt::internal
 {
+auto Model::BeginBatch() noexcept -> void {}
+
 auto Model::ChangeRow(ui::internal::Row*, ui::internal::Row*) noexcept -> void
 {
 }
 
 auto Model::DeleteRow(ui::internal::Row*) noexcept -> void {}
 
+auto Model::EndBatch() noexcept -> void {}
+
 auto Model::InsertRow(
     ui::internal::Row*,
     ui::internal::Row*,
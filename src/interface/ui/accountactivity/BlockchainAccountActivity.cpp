@@ -159,6 +159,7 @@ auto BlockchainAccountActivity::load_thread() noexcept -> void
             return {};
         }
     }();
+    const auto batch = start_batch();
     auto active = UnallocatedSet<AccountActivityRowID>{};
 
     for (const auto& txid : transactions) {
@@ -330,6 +331,7 @@ auto BlockchainAccountActivity::process_contact(const Message& in) noexcept
 
         return out;
     }();
+    const auto batch = start_batch();
 
     for (const auto& txid : txids) { process_txid(txid); }
 }
@@ -583,11 +583,15 @@ auto CustodialAccountActivity::startup() noexcept -> void
 
     const auto workflows =
         Widget::api_.Workflow().WorkflowsByAccount(primary_id_, account_id_);
-    auto active = UnallocatedSet<AccountActivityRowID>{};
 
-    for (const auto& id : workflows) { process_workflow(id, active); }
+    {
+        const auto batch = start_batch();
+        auto active = UnallocatedSet<AccountActivityRowID>{};
 
-    delete_inactive(active);
+        for (const auto& id : workflows) { process_workflow(id, active); }
+
+        delete_inactive(active);
+    }
 
     if (aliasChanged) {
         // TODO Qt widgets need to know the alias property has changed
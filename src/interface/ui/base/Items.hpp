@@ -5,10 +5,27 @@
 
 #pragma once
 
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/indexed_by.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/ranked_index.hpp>
+#include <boost/multi_index/tag.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/tuple/tuple.hpp>
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <stdexcept>
+#include <utility>
 
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 
@@ -30,6 +47,8 @@ struct Row;
 
 namespace opentxs::ui::implementation
 {
+/// Rows ordered by (SortKey, RowID) in an order statistic tree so that
+/// insert, move, delete, and positional lookups are all O(log n)
 template <typename RowID, typename SortKey, typename RowPointer>
 class ListItems
 {
@@ -39,20 +58,43 @@ public:
         RowID id_;
         RowPointer item_;
     };
-    using Data = UnallocatedList<Row>;
+
+private:
+    struct ByID {
+    };
+    // NOTE Data keeps a pointer to its parent in the comparator so ListItems
+    // can not be copied or moved
+    struct Compare {
+        const ListItems* parent_;
+
+        auto operator()(const Row& lhs, const Row& rhs) const noexcept -> bool
+        {
+            return parent_->sort(rhs.key_, rhs.id_, lhs.key_, lhs.id_);
+        }
+    };
+
+public:
+    using Data = boost::multi_index_container<
+        Row,
+        boost::multi_index::indexed_by<
+            boost::multi_index::
+                ranked_unique<boost::multi_index::identity<Row>, Compare>,
+            boost::multi_index::ordered_unique<
+                boost::multi_index::tag<ByID>,
+                boost::multi_index::member<Row, RowID, &Row::id_>>>>;
     using Iterator = typename Data::iterator;
-    using Index = UnallocatedMap<RowID, Iterator>;
     using Insert = std::pair<Iterator, internal::Row*>;
     using Position = std::pair<Iterator, std::size_t>;
     using Move = std::pair<Insert, Insert>;
 
     auto active() const noexcept -> UnallocatedVector<RowID>
     {
+        const auto& index = data_.template get<ByID>();
         auto output = UnallocatedVector<RowID>{};
-        output.reserve(index_.size());
+        output.reserve(index.size());
         std::transform(
-            index_.begin(), index_.end(), std::back_inserter(output), [
-            ](const auto& in) -> auto{ return in.first; });
+            index.begin(), index.end(), std::back_inserter(output), [
+            ](const auto& in) -> auto{ return in.id_; });
 
         return output;
     }
@@ -60,15 +102,15 @@ public:
     {
         if (0u == data_.size()) { return true; }
 
-        if (auto i = index_.find(row); index_.end() == i) { return true; }
+        if (false == exists(row)) { return true; }
 
-        const auto& [key, id, item] = data_.back();
+        const auto& [key, id, item] = *data_.rbegin();
 
         return row == id;
     }
     auto size() const noexcept { return data_.size(); }
 
-    auto at(const std::size_t pos) -> Row&
+    auto at(const std::size_t pos) -> const Row&
     {
         if (pos < offset_) {
             throw std::out_of_range("Invalid position (offset)");
@@ -80,30 +122,22 @@ public:
             throw std::out_of_range("Invalid position");
         }
 
-        auto output = data_.begin();
-        std::advance(output, eff);
-
-        return *output;
+        return *data_.nth(eff);
     }
-    auto get(const RowID& id) -> Row& { return *index_.at(id); }
+    auto get(const RowID& id) -> const Row& { return *find(id); }
     auto begin() noexcept -> Iterator { return data_.begin(); }
-    auto delete_row(const RowID& id, Iterator position) noexcept -> void
+    auto delete_row(const RowID&, Iterator position) noexcept -> void
     {
         data_.erase(position);
-        index_.erase(id);
     }
     auto end() noexcept -> Iterator { return data_.end(); }
     auto find_delete_position(const RowID& id) noexcept
         -> std::optional<Position>
     {
         try {
-            const auto it = index_.at(id);
-
-            return Position{
-                it,
-                static_cast<std::size_t>(std::distance(data_.begin(), it)) +
-                    offset_};
+            const auto it = find(id);
 
+            return Position{it, data_.rank(it) + offset_};
         } catch (...) {
 
             return std::nullopt;
@@ -112,77 +146,30 @@ public:
     auto find_insert_position(const SortKey& key, const RowID& id) noexcept
         -> Insert
     {
-        auto output = Insert{data_.end(), nullptr};
-        auto& [it, before] = output;
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
+        const auto it = data_.lower_bound(Row{key, id, {}});
 
-            if (sort(key, id, rKey, rId)) {
-
-                continue;
-            } else {
-                it = i;
-
-                break;
-            }
-        }
-
-        if (data_.begin() != it) {
-            const auto& [rKey, rId, item] = *std::prev(it);
-            before = item.get();
-        }
-
-        return output;
+        return Insert{it, previous(it)};
     }
     auto find_move_position(
         const RowID& oldId,
         const SortKey& newKey,
         const RowID& newID) noexcept -> std::optional<Move>
     {
-        auto output = Move{{data_.end(), nullptr}, {data_.end(), nullptr}};
-        auto& [from, to] = output;
-        auto& [it, before] = to;
-
         try {
-            const auto it = index_.at(oldId);
-            from = Insert{it, [&]() -> internal::Row* {
-                              if (data_.begin() == it) {
+            const auto from = find(oldId);
+            const auto to = data_.lower_bound(Row{newKey, newID, {}});
 
-                                  return nullptr;
-                              } else {
-
-                                  return std::prev(it)->item_.get();
-                              }
-                          }()};
+            return Move{Insert{from, previous(from)}, Insert{to, previous(to)}};
         } catch (...) {
 
             return std::nullopt;
         }
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(newKey, newID, rKey, rId)) {
-                before = item.get();
-
-                continue;
-            }
-
-            it = i;
-
-            break;
-        }
-
-        return std::move(output);
     }
     auto get_index(const RowID& id) noexcept -> std::optional<std::size_t>
     {
         try {
 
-            return static_cast<std::size_t>(
-                       std::distance(data_.begin(), index_.at(id))) +
-                   offset_;
+            return data_.rank(find(id)) + offset_;
         } catch (...) {
 
             return std::nullopt;
@@ -194,43 +181,71 @@ public:
         const RowID& id,
         const RowPointer& item) noexcept -> RowPointer
     {
-        auto& index = index_[id];
-        index = data_.emplace(position, Row{key, id, item});
-
-        return index->item_;
+        return data_.emplace_hint(position, Row{key, id, item})->item_;
     }
     auto move_before(
-        const RowID& oldId,
         Iterator oldPosition,
         const SortKey& newKey,
-        const RowID& newID,
-        Iterator newPosition) noexcept -> void
+        const RowID& newID) noexcept -> void
     {
-        index_.erase(oldId);
-        auto& oldData = *oldPosition;
-        auto& index = index_[newID];
-        index = data_.emplace(newPosition, Row{newKey, newID, oldData.item_});
-        data_.erase(oldPosition);
+        const auto moved = data_.modify(oldPosition, [&](auto& row) {
+            row.key_ = newKey;
+            row.id_ = newID;
+        });
+
+        OT_ASSERT(moved);
     }
 
     ListItems(std::size_t offset, bool reverse) noexcept
         : offset_(offset)
         , reverse_sort_(reverse)
-        , data_()
-        , index_()
+        , data_(boost::make_tuple(
+              boost::make_tuple(
+                  boost::multi_index::identity<Row>{},
+                  Compare{this}),
+              typename Data::template index<ByID>::type::ctor_args{}))
     {
     }
+    ListItems() = delete;
+    ListItems(const ListItems&) = delete;
+    ListItems(ListItems&&) = delete;
+    auto operator=(const ListItems&) -> ListItems& = delete;
+    auto operator=(ListItems&&) -> ListItems& = delete;
 
 private:
     const std::size_t offset_;
     const bool reverse_sort_;
     Data data_;
-    Index index_;
 
     auto compare_id(const RowID& lhs, const RowID& rhs) const noexcept -> bool;
     auto compare_key(const SortKey& lhs, const SortKey& rhs) const noexcept
         -> bool;
 
+    auto exists(const RowID& id) const noexcept -> bool
+    {
+        const auto& index = data_.template get<ByID>();
+
+        return index.end() != index.find(id);
+    }
+    auto find(const RowID& id) noexcept(false) -> Iterator
+    {
+        const auto& index = data_.template get<ByID>();
+        const auto it = index.find(id);
+
+        if (index.end() == it) { throw std::out_of_range("Invalid id"); }
+
+        return data_.template project<0>(it);
+    }
+    auto previous(const Iterator& it) const noexcept -> internal::Row*
+    {
+        if (data_.begin() == it) {
+
+            return nullptr;
+        } else {
+
+            return std::prev(it)->item_.get();
+        }
+    }
     auto sort(
         const SortKey& incomingKey,
         const RowID& incomingID,
@@ -251,4 +266,89 @@ private:
         }
     }
 };
+
+/// Immutable copy of the row order which readers use instead of the list
+/// lock. It is rebuilt from the rows on the first read after a batch which
+/// changed them, so a run of single row updates costs one copy instead of one
+/// per row.
+template <typename RowID, typename SortKey, typename RowPointer>
+class ListSnapshot
+{
+public:
+    using Items = ListItems<RowID, SortKey, RowPointer>;
+
+    struct Rows {
+        UnallocatedVector<RowPointer> rows_{};
+        UnallocatedVector<RowID> ids_{};
+        std::optional<RowID> last_{};
+    };
+
+    /// Returns the rows as of the end of the most recent batch which changed
+    /// them. The thread which holds an open batch reads the last snapshot
+    /// that was built.
+    auto Get(std::recursive_mutex& mutex, Items& items) noexcept
+        -> std::shared_ptr<const Rows>
+    {
+        if (stale_.load()) {
+            auto lock = rLock{mutex};
+
+            if ((0u == depth_) && stale_.load()) {
+                build(items);
+                stale_.store(false);
+            }
+        }
+
+        return std::atomic_load(&current_);
+    }
+
+    /// Begin, Changed, and End must be called with the list lock held. Begin
+    /// returns true when the outermost batch opens and End returns true when
+    /// it closes.
+    auto Begin() noexcept -> bool { return 0u == depth_++; }
+    auto Changed() noexcept -> void { changed_ = true; }
+    auto End() noexcept -> bool
+    {
+        OT_ASSERT(0u < depth_);
+
+        if (0u < --depth_) { return false; }
+
+        if (std::exchange(changed_, false)) { stale_.store(true); }
+
+        return true;
+    }
+
+    ListSnapshot() noexcept
+        : depth_(0)
+        , changed_(false)
+        , stale_(false)
+        , current_(std::make_shared<const Rows>())
+    {
+    }
+
+private:
+    std::size_t depth_;
+    bool changed_;
+    std::atomic<bool> stale_;
+    std::shared_ptr<const Rows> current_;
+
+    auto build(Items& items) noexcept -> void
+    {
+        auto next = std::make_shared<Rows>();
+        next->rows_.reserve(items.size());
+
+        for (const auto& row : items) {
+            next->rows_.emplace_back(row.item_);
+            next->last_.emplace(row.id_);
+        }
+
+        next->ids_ = items.active();
+        std::atomic_store(
+            &current_, std::shared_ptr<const Rows>{std::move(next)});
+    }
+
+    ListSnapshot(const ListSnapshot&) = delete;
+    ListSnapshot(ListSnapshot&&) = delete;
+    auto operator=(const ListSnapshot&) -> ListSnapshot& = delete;
+    auto operator=(ListSnapshot&&) -> ListSnapshot& = delete;
+};
 }  // namespace opentxs::ui::implementation
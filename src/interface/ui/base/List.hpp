@@ -5,8 +5,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -65,26 +70,38 @@ public:
     auto API() const noexcept -> const api::Session& final { return api_; }
     auto First() const noexcept -> SharedPimpl<RowInterface> override
     {
-        auto lock = rLock{recursive_lock_};
-        counter_ = 0;
+        const auto snapshot = snapshot_.Get(recursive_lock_, items_);
+        counter_.store(0);
+
+        if (snapshot->rows_.empty()) {
+
+            return SharedPimpl<RowInterface>(blank_p_);
+        } else {
 
-        return first(lock);
+            return SharedPimpl<RowInterface>(snapshot->rows_.front());
+        }
     }
     auto last(const RowID& id) const noexcept -> bool override
     {
-        auto lock = rLock{recursive_lock_};
+        const auto snapshot = snapshot_.Get(recursive_lock_, items_);
+        const auto& ids = snapshot->ids_;
+
+        if (false == std::binary_search(ids.begin(), ids.end(), id)) {
+
+            return true;
+        }
 
-        return items_.last(id);
+        return id == snapshot->last_;
     }
     auto Next() const noexcept -> SharedPimpl<RowInterface> override
     {
-        // TODO this logic only works for an offset_ value of 0 or 1
-        auto lock = rLock{recursive_lock_};
+        const auto snapshot = snapshot_.Get(recursive_lock_, items_);
+        const auto index = ++counter_;
 
-        try {
+        if (index < snapshot->rows_.size()) {
 
-            return SharedPimpl<RowInterface>(items_.at(++counter_).item_);
-        } catch (...) {
+            return SharedPimpl<RowInterface>(snapshot->rows_[index]);
+        } else {
 
             return First();
         }
@@ -122,11 +139,39 @@ public:
 protected:
     using RowPointer = std::shared_ptr<RowInternal>;
 
+    /// Holds the list lock and defers the row snapshot, widget callbacks, and
+    /// Qt row notifications until the outermost batch ends so that bulk
+    /// updates are delivered together
+    class Batch
+    {
+    public:
+        Batch(const List& parent) noexcept
+            : parent_(parent)
+            , lock_(parent_.recursive_lock_)
+        {
+            if (parent_.snapshot_.Begin() && (nullptr != parent_.qt_model_)) {
+                parent_.qt_model_->BeginBatch();
+            }
+        }
+
+        ~Batch() { parent_.end_batch(lock_); }
+
+    private:
+        const List& parent_;
+        rLock lock_;
+
+        Batch() = delete;
+        Batch(const Batch&) = delete;
+        Batch(Batch&&) = delete;
+        auto operator=(const Batch&) -> Batch& = delete;
+        auto operator=(Batch&&) -> Batch& = delete;
+    };
+
     ui::qt::internal::Model* qt_model_;
     mutable std::recursive_mutex recursive_lock_;
     mutable std::shared_mutex shared_lock_;
     const PrimaryID primary_id_;
-    mutable std::size_t counter_;
+    mutable std::atomic<std::size_t> counter_;
     mutable OTFlag have_items_;
     mutable OTFlag start_;
     std::unique_ptr<std::thread> startup_;  // TODO remove
@@ -140,6 +185,7 @@ protected:
     auto delete_inactive(const rLock& lock, const UnallocatedSet<RowID>& active)
         const noexcept -> void
     {
+        const auto batch = start_batch();
         const auto existing = items_.active();
         auto deleteIDs = UnallocatedVector<RowID>{};
         std::set_difference(
@@ -151,7 +197,7 @@ protected:
 
         for (const auto& id : deleteIDs) { delete_item(lock, id); }
 
-        if (0 < deleteIDs.size()) { UpdateNotify(); }
+        if (0 < deleteIDs.size()) { notify_ = true; }
     }
     auto delete_item(const RowID& id) const noexcept -> void
     {
@@ -160,10 +206,13 @@ protected:
     }
     auto delete_item(const rLock&, const RowID& id) const noexcept -> void
     {
+        const auto batch = start_batch();
         auto position = items_.find_delete_position(id);
 
         if (false == position.has_value()) { return; }
 
+        snapshot_.Changed();
+
         auto& [it, index] = position.value();
 
         if (nullptr != qt_model_) { qt_model_->DeleteRow(it->item_.get()); }
@@ -188,16 +237,6 @@ protected:
         for (const auto& row : items_) { cb(*row.item_); }
     }
 
-    auto first(const rLock&) const noexcept -> SharedPimpl<RowInterface>
-    {
-        try {
-
-            return SharedPimpl<RowInterface>(items_.at(0).item_);
-        } catch (...) {
-
-            return SharedPimpl<RowInterface>(blank_p_);
-        }
-    }
     auto lookup(const rLock&, const RowID& id) const noexcept
         -> const RowInternal&
     {
@@ -220,6 +259,7 @@ protected:
             return {};
         }
     }
+    auto start_batch() const noexcept -> Batch { return Batch{*this}; }
     auto startup_complete() const noexcept -> bool
     {
         static constexpr auto none = 0s;
@@ -256,6 +296,7 @@ protected:
     auto add_items(ChildDefinitions&& items) noexcept -> void
     {
         auto lock = rLock{recursive_lock_};
+        const auto batch = start_batch();
 
         for (auto& [id, key, custom, children] : items) {
             auto& item = add_item(lock, id, key, custom);
@@ -274,9 +315,11 @@ protected:
         ui::internal::Row* parent,
         ui::internal::Row* row) noexcept -> void
     {
+        const auto batch = start_batch();
+
         if (qt_model_) { qt_model_->ChangeRow(parent, row); }
 
-        UpdateNotify();
+        notify_ = true;
     }
 
     // NOTE lists that are also rows call this constructor
@@ -302,6 +345,8 @@ protected:
         , subnode_(subnode)
         , init_(false)
         , items_(0, reverseSort)
+        , notify_(false)
+        , snapshot_()
         , startup_promise_()
         , startup_future_(startup_promise_.get_future())
     {
@@ -332,12 +377,15 @@ protected:
 
 private:
     using ItemsType = ListItems<RowID, SortKey, RowPointer>;
+    using SnapshotType = ListSnapshot<RowID, SortKey, RowPointer>;
 
     const std::shared_ptr<const RowInternal> blank_p_;
     const RowInternal& blank_;
     const bool subnode_;
     mutable std::atomic<bool> init_;
     mutable ItemsType items_;
+    mutable bool notify_;
+    mutable SnapshotType snapshot_;
     std::promise<void> startup_promise_;
     std::shared_future<void> startup_future_;
 
@@ -345,6 +393,17 @@ private:
         const RowID& id,
         const SortKey& index,
         CustomData& custom) const noexcept -> RowPointer = 0;
+    auto end_batch(rLock& lock) const noexcept -> void
+    {
+        if (false == snapshot_.End()) { return; }
+
+        const auto notify = std::exchange(notify_, false);
+        lock.unlock();
+
+        if (nullptr != qt_model_) { qt_model_->EndBatch(); }
+
+        if (notify) { UpdateNotify(); }
+    }
     virtual auto post_insert(const RowInternal&) const noexcept -> void {}
     virtual auto post_reindex(const RowInternal&) const noexcept -> void {}
     virtual auto pre_delete(const RowInternal&) const noexcept -> void {}
@@ -356,6 +415,7 @@ private:
         const SortKey& key,
         CustomData& custom) noexcept -> RowInternal&
     {
+        const auto batch = start_batch();
         auto pointer = construct_row(id, key, custom);
 
         OT_ASSERT(pointer);
@@ -369,7 +429,8 @@ private:
         }
 
         post_insert(*pointer);
-        UpdateNotify();
+        snapshot_.Changed();
+        notify_ = true;
 
         return *pointer;
     }
@@ -379,13 +440,14 @@ private:
         const SortKey& key,
         CustomData& custom) noexcept -> RowInternal&
     {
+        const auto batch = start_batch();
         auto move = items_.find_move_position(id, key, id);
 
         OT_ASSERT(move.has_value());
 
         auto& [from, to] = move.value();
         auto& [source, oldBefore] = from;
-        auto& [dest, newBefore] = to;
+        const auto& newBefore = to.second;
         auto* item = source->item_.get();
         auto* parent = qt_parent();
 
@@ -399,7 +461,8 @@ private:
                 qt_model_->MoveRow(parent, newBefore, item);
             }
 
-            items_.move_before(id, source, key, id, dest);
+            items_.move_before(source, key, id);
+            snapshot_.Changed();
         }
 
         pre_reindex(*item);
@@ -409,7 +472,7 @@ private:
         if (changed) {
             row_modified(parent, item);
         } else if (false == samePosition) {
-            UpdateNotify();
+            notify_ = true;
         }
 
         return *item;
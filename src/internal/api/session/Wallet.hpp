@@ -13,6 +13,7 @@
 #include "internal/util/Shared.hpp"
 #include "opentxs/api/session/Wallet.hpp"
 #include "opentxs/otx/blind/CashType.hpp"
+#include "util/Sharded.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -52,6 +53,9 @@ class Wallet : virtual public api::session::Wallet
 public:
     virtual auto Account(const Identifier& accountID) const
         -> SharedAccount = 0;
+    /// Per shard lookup counters of the account cache
+    virtual auto AccountCacheStatistics() const noexcept
+        -> ShardedStatistics = 0;
     virtual auto CreateAccount(
         const identifier::Nym& ownerNymID,
         const identifier::Notary& notaryID,
@@ -111,6 +115,8 @@ public:
 
     using session::Wallet::Nym;
     virtual auto Nym(const proto::Nym& nym) const -> Nym_p = 0;
+    /// Per shard lookup counters of the nym cache
+    virtual auto NymCacheStatistics() const noexcept -> ShardedStatistics = 0;
 
     virtual auto mutable_Nymfile(
         const identifier::Nym& id,
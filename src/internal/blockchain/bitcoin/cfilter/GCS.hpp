@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/util/Allocator.hpp"
@@ -47,6 +48,15 @@ auto GolombEncode(
     const std::uint8_t P,
     const Elements& hashedSet,
     alloc::Default alloc) noexcept(false) -> Vector<std::byte>;
+// Returns the intersection of a sorted, deduplicated set of targets with an
+// encoded filter. The filter is decoded only as far as necessary and the
+// decoded elements are not stored.
+auto GolombMatch(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    const Elements& targets,
+    alloc::Default alloc) noexcept(false) -> Elements;
 auto HashToRange(
     const api::Session& api,
     const ReadView key,
@@ -64,6 +74,12 @@ auto Siphash(
     const api::Session& api,
     const ReadView key,
     const ReadView item) noexcept(false) -> Hash;
+// Produces the same output as calling Siphash for each item, without the
+// per item overhead of the crypto api
+auto SiphashBatch(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes;
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::internal
@@ -72,9 +88,16 @@ class GCS
 {
 public:
     using PrehashedMatches = Vector<gcs::Hashes::const_iterator>;
+    using PrehashedTargets = Vector<const gcs::Hashes*>;
 
     virtual auto Match(const gcs::Hashes& prehashed) const noexcept
         -> PrehashedMatches = 0;
+    /// Matches several target sets against the filter in a single pass. The
+    /// decoded filter is kept in a cache which is shared by all filter
+    /// instances for the same block. Returns nothing if the filter can not be
+    /// decoded.
+    virtual auto Match(const PrehashedTargets& prehashed) const noexcept
+        -> std::optional<Vector<PrehashedMatches>> = 0;
     virtual auto Range() const noexcept -> gcs::Range = 0;
     virtual auto Serialize(proto::GCS& out) const noexcept -> bool = 0;
     virtual auto Test(const gcs::Hashes& targets) const noexcept -> bool = 0;
@@ -72,8 +72,9 @@ namespace opentxs::blockchain::block::internal
 {
 struct Block : virtual public block::Block {
     virtual auto CalculateSize() const noexcept -> std::size_t = 0;
-    virtual auto ExtractElements(const cfilter::Type style) const noexcept
-        -> Vector<Vector<std::byte>> = 0;
+    /// Throws std::runtime_error if a transaction can not be decoded
+    virtual auto ExtractElements(const cfilter::Type style) const
+        noexcept(false) -> Vector<Vector<std::byte>> = 0;
     virtual auto FindMatches(
         const cfilter::Type type,
         const Patterns& txos,
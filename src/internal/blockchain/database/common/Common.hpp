@@ -46,6 +46,8 @@ using Address = p2p::internal::Address;
 using Address_p = std::unique_ptr<Address>;
 using CFilterParams = node::internal::FilterDatabase::CFilterParams;
 using CFHeaderParams = node::internal::FilterDatabase::CFHeaderParams;
+using EncodedFilterCallback =
+    node::internal::FilterDatabase::EncodedFilterCallback;
 using Position = block::Position;
 using Protocol = p2p::Protocol;
 using Service = p2p::Service;
@@ -77,6 +79,8 @@ enum Table {
     FilterIndexBCH = 20,
     FilterIndexES = 21,
     TransactionIndex = 22,
+    BulkFreeSpace = 23,
+    SyncFreeSpace = 24,
 };
 
 auto ChainToSyncTable(const opentxs::blockchain::Type chain) noexcept(false)
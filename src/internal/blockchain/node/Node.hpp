@@ -12,6 +12,7 @@
 #include <boost/thread/thread.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <future>
 #include <iosfwd>
 #include <memory>
@@ -276,6 +277,13 @@ struct FilterDatabase {
     using CFHeaderParams =
         std::tuple<block::Hash, cfilter::Header, cfilter::Hash>;
     using CFilterParams = std::pair<block::Hash, GCS>;
+    // Receives the element count and Golomb-coded bytes of one stored
+    // filter. The bytes are only valid until the callback returns.
+    using EncodedFilterCallback =
+        std::function<bool(const std::uint32_t, const ReadView)>;
+
+    // Number of filters requested from LoadEncodedFilters at once
+    static constexpr auto encoded_filter_batch_ = std::size_t{16};
 
     virtual auto FilterHeaderTip(const cfilter::Type type) const noexcept
         -> block::Position = 0;
@@ -293,6 +301,12 @@ struct FilterDatabase {
     virtual auto LoadFilters(
         const cfilter::Type type,
         const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS> = 0;
+    // Returns the number of filters passed to the callback. Stops at the
+    // first missing filter or when the callback returns false.
+    virtual auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const EncodedFilterCallback& cb) const noexcept -> std::size_t = 0;
     virtual auto LoadFilterHash(const cfilter::Type type, const ReadView block)
         const noexcept -> cfilter::Hash = 0;
     virtual auto LoadFilterHeader(
@@ -325,6 +339,11 @@ struct FilterOracle : virtual public node::FilterOracle {
     virtual auto GetFilterJob() const noexcept -> CfilterJob = 0;
     virtual auto GetHeaderJob() const noexcept -> CfheaderJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
+    virtual auto LoadEncodedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        const FilterDatabase::EncodedFilterCallback& cb) const noexcept
+        -> std::size_t = 0;
     virtual auto LoadFilterOrResetTip(
         const cfilter::Type type,
         const block::Position& position,
@@ -348,6 +367,10 @@ struct HeaderDatabase {
     // Throws std::out_of_range if no block at that position
     virtual auto BestBlock(const block::Height position) const noexcept(false)
         -> block::Hash = 0;
+    // Returns -1 if the hash is not part of the best chain
+    virtual auto BestHeight(const block::Hash& hash) const noexcept
+        -> block::Height = 0;
+    virtual auto BestPosition() const noexcept -> block::Position = 0;
     virtual auto CurrentBest() const noexcept
         -> std::unique_ptr<block::Header> = 0;
     virtual auto CurrentCheckpoint() const noexcept -> block::Position = 0;
@@ -426,6 +449,7 @@ struct PeerManager {
         JobAvailableCfheaders = OT_ZMQ_INTERNAL_SIGNAL + 4,
         JobAvailableCfilters = OT_ZMQ_INTERNAL_SIGNAL + 5,
         JobAvailableBlock = OT_ZMQ_INTERNAL_SIGNAL + 6,
+        SendCfilters = OT_ZMQ_INTERNAL_SIGNAL + 7,
         ActivityTimeout = OT_ZMQ_INTERNAL_SIGNAL + 124,
         NeedPing = OT_ZMQ_INTERNAL_SIGNAL + 125,
         Body = OT_ZMQ_INTERNAL_SIGNAL + 126,
@@ -468,6 +468,15 @@ auto BitcoinP2PCfilter(
     const blockchain::block::Hash& hash,
     const blockchain::GCS& filter)
     -> blockchain::p2p::bitcoin::message::internal::Cfilter*;
+// Serializes a cfilter message directly from the stored filter bytes
+// without constructing a GCS or a message object.
+auto BitcoinP2PCfilterFrames(
+    const api::Session& api,
+    const blockchain::Type network,
+    const blockchain::cfilter::Type type,
+    const blockchain::block::Hash& hash,
+    const std::uint32_t count,
+    const ReadView compressed) noexcept -> std::pair<zmq::Frame, zmq::Frame>;
 auto BitcoinP2PCmpctblock(
     const api::Session& api,
     std::unique_ptr<blockchain::p2p::bitcoin::Header> pHeader,
@@ -1647,6 +1647,56 @@ auto make_progress(
 
 namespace opentxs::ui::qt::internal
 {
+/// Returns the contiguous runs of the specified row positions as pairs of
+/// first and last position, ordered from the end of the list so that the
+/// positions of the remaining runs stay valid as each run is removed
+auto ContiguousRuns(UnallocatedVector<int> positions) noexcept
+    -> UnallocatedVector<std::pair<int, int>>;
+
+/// Row notifications which are held while a batch is open. Consecutive
+/// deletes are merged into one operation, as are consecutive inserts which
+/// form a single range under the same parent. Only the first change to a row
+/// is kept. Not thread safe.
+class RowQueue
+{
+public:
+    enum class Op { change, insert, move, remove };
+
+    struct Operation {
+        Op type_;
+        ui::internal::Row* parent_;
+        ui::internal::Row* after_;
+        UnallocatedVector<ui::internal::Row*> rows_;
+        UnallocatedDeque<std::shared_ptr<ui::internal::Row>> inserted_;
+
+        Operation(
+            const Op type,
+            ui::internal::Row* parent,
+            ui::internal::Row* after) noexcept;
+    };
+
+    using Operations = UnallocatedVector<Operation>;
+
+    auto empty() const noexcept -> bool { return queue_.empty(); }
+
+    auto Change(ui::internal::Row* parent, ui::internal::Row* row) noexcept
+        -> void;
+    auto Delete(ui::internal::Row* row) noexcept -> void;
+    auto Insert(
+        ui::internal::Row* parent,
+        ui::internal::Row* after,
+        std::shared_ptr<ui::internal::Row> row) noexcept -> void;
+    auto Move(
+        ui::internal::Row* newParent,
+        ui::internal::Row* newBefore,
+        ui::internal::Row* row) noexcept -> void;
+    auto Take() noexcept -> Operations;
+
+private:
+    Operations queue_{};
+    UnallocatedSet<const ui::internal::Row*> changed_{};
+};
+
 struct Index {
     bool valid_{false};
     int row_{-1};
@@ -1669,10 +1719,15 @@ struct Model {
     auto GetRoleData() const noexcept -> RoleData;
     auto GetRowCount(ui::internal::Row* row) const noexcept -> int;
 
+    /// Row notifications are queued until the outermost EndBatch and then
+    /// delivered to the Qt model with adjacent inserts and deletes merged
+    /// into ranges
+    auto BeginBatch() noexcept -> void;
     auto ChangeRow(ui::internal::Row* parent, ui::internal::Row* row) noexcept
         -> void;
     auto ClearParent() noexcept -> void;
     auto DeleteRow(ui::internal::Row* row) noexcept -> void;
+    auto EndBatch() noexcept -> void;
     auto InsertRow(
         ui::internal::Row* parent,
         ui::internal::Row* after,
@@ -77,6 +77,7 @@ public:
     virtual auto RawSocket(socket::Type type) const noexcept -> socket::Raw = 0;
     virtual auto Start(BatchID id, StartArgs&& sockets) const noexcept
         -> Thread* = 0;
+    virtual auto Statistics() const noexcept -> PoolStatistics = 0;
     virtual auto Thread(BatchID id) const noexcept -> Thread* = 0;
     virtual auto ThreadID(BatchID id) const noexcept -> std::thread::id = 0;
 
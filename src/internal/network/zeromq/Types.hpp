@@ -5,9 +5,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <future>
+#include <thread>
 #include <tuple>
 
 #include "opentxs/network/zeromq/socket/Types.hpp"
@@ -47,6 +50,34 @@ using EndpointArg = std::pair<CString, socket::Direction>;
 using EndpointArgs = Vector<EndpointArg>;
 using SocketData = std::pair<socket::Type, EndpointArgs>;
 
+struct ThreadStatistics {
+    std::thread::id id_{};
+    // Number of times zmq_poll returned with at least one readable socket
+    std::uint64_t wakeups_{};
+    // Total number of messages delivered to callbacks
+    std::uint64_t messages_{};
+    // Number of messages delivered during the most recent wakeup
+    std::size_t last_batch_{};
+    // Largest number of messages delivered during a single wakeup
+    std::size_t max_batch_{};
+    // Number of sockets which still had messages waiting when their
+    // receive budget was exhausted during the most recent wakeup
+    std::size_t backlog_{};
+    // Total time spent executing receive callbacks
+    std::chrono::nanoseconds busy_{};
+    // Fraction of wall clock time spent executing receive callbacks during
+    // the most recent rebalancing interval
+    double utilization_{};
+    // Number of batches currently assigned to the thread
+    std::size_t batches_{};
+    // Number of sockets currently polled by the thread
+    std::size_t sockets_{};
+    // Number of batches which were moved away from the thread to balance load
+    std::uint64_t migrated_{};
+};
+
+using PoolStatistics = UnallocatedVector<ThreadStatistics>;
+
 auto GetBatchID() noexcept -> BatchID;
 auto GetSocketID() noexcept -> SocketID;
 }  // namespace opentxs::network::zeromq
@@ -5,7 +5,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+
 #include "Proto.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -30,4 +35,12 @@ auto ZMQFrame(std::size_t size) noexcept -> network::zeromq::Frame;
 auto ZMQFrame(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Frame;
 auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame;
+/// Take ownership of the buffer instead of copying it
+auto ZMQFrame(Space&& data) noexcept -> network::zeromq::Frame;
+/// Take ownership of the buffer instead of copying it, unless the vector
+/// uses a memory resource which might not outlive the frame
+auto ZMQFrame(Vector<std::byte>&& data) noexcept -> network::zeromq::Frame;
+/// Reference bytes kept alive by owner instead of copying them
+auto ZMQFrame(std::shared_ptr<const void> owner, const ReadView bytes) noexcept
+    -> network::zeromq::Frame;
 }  // namespace opentxs::factory
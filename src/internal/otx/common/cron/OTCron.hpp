@@ -9,8 +9,10 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <utility>
 
 #include "internal/otx/common/Contract.hpp"
+#include "internal/otx/common/cron/OTJournal.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/identity/Types.hpp"
@@ -43,6 +45,7 @@ class Amount;
 class Armored;
 class Identifier;
 class OTCronItem;
+class OTJournalEntry;
 class OTMarket;
 class PasswordPrompt;
 
@@ -52,6 +55,8 @@ using mapOfCronItems =
 /** multimapOfCronItems: Mapped to date the item was added to Cron. */
 using multimapOfCronItems =
     UnallocatedMultimap<Time, std::shared_ptr<OTCronItem>>;
+/** scheduleOfCronItems: Transaction numbers ordered by next due date. */
+using scheduleOfCronItems = UnallocatedSet<std::pair<Time, std::int64_t>>;
 /** Mapped (uniquely) to market ID. */
 using mapOfMarkets =
     UnallocatedMap<UnallocatedCString, std::shared_ptr<OTMarket>>;
@@ -151,6 +156,7 @@ public:
      * finished.) */
     void ProcessCronItems();
 
+    /** Time remaining until the next cron item is due to be processed. */
     auto computeTimeout() -> std::chrono::milliseconds;
 
     inline void SetNotaryID(const identifier::Notary& NOTARY_ID)
@@ -166,7 +172,13 @@ public:
     inline auto GetServerNym() const -> Nym_p { return m_pServerNym; }
 
     auto LoadCron() -> bool;
+    /** Writes a complete snapshot of Cron. Individual changes should be
+     * persisted with SaveCronItem or SaveTransactionNumbers instead. */
     auto SaveCron() -> bool;
+    /** Journals the current state of an item which is already on Cron. */
+    auto SaveCronItem(const OTCronItem& theItem) -> bool;
+    /** Journals the current list of transaction numbers. */
+    auto SaveTransactionNumbers() -> bool;
 
     ~OTCron() final;
 
@@ -182,6 +194,8 @@ public:
 
 private:
     using ot_super = Contract;
+    using CronItemIndex = std::
+        pair<multimapOfCronItems::iterator, scheduleOfCronItems::iterator>;
 
     friend api::session::server::Factory;
 
@@ -200,6 +214,10 @@ private:
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Cron Items ordered by the time they are next due to be processed.
+    scheduleOfCronItems m_setSchedule;
+    // Position of each Cron Item on the multimap and on the schedule.
+    UnallocatedMap<std::int64_t, CronItemIndex> m_mapCronIndex;
     // Always store this in any object that's associated with a specific server.
     OTNotaryID m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
@@ -209,6 +227,21 @@ private:
     bool m_bIsActivated{false};
     // I'll need this for later.
     Nym_p m_pServerNym{nullptr};
+    // Changes made since the most recent snapshot.
+    OTJournal m_journal;
+    // Sequence number of the first journal entry not included in the snapshot
+    // being loaded.
+    std::int64_t m_lJournalStart{0};
+
+    auto erase_item(mapOfCronItems::iterator it) -> void;
+    auto replay(const OTJournalEntry& entry) -> bool;
+    auto reschedule(const std::int64_t lTransactionNum, const Time due)
+        -> void;
+    auto save_change(
+        const UnallocatedCString& type,
+        const std::int64_t value,
+        const Time date,
+        const String& payload) -> bool;
 
     explicit OTCron(const api::Session& server);
 
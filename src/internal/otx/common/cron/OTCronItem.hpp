@@ -197,6 +197,10 @@ public:
                   // chance to expire, etc.
                   // From OTTrackable
                   // (parent class of this)
+    // The earliest time at which ProcessCron might do more than return
+    // immediately. OTCron uses this to schedule the item, so overrides must
+    // never return a time later than the one at which ProcessCron would act.
+    virtual auto GetNextDueDate() const -> Time;
     ~OTCronItem() override;
 
     void InitCronItem();
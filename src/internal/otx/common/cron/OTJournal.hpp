@@ -0,0 +1,130 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <irrxml/irrXML.hpp>
+#include <cstdint>
+#include <functional>
+
+#include "internal/otx/common/Contract.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
+
+namespace opentxs
+{
+namespace api
+{
+class Session;
+}  // namespace api
+
+namespace identity
+{
+class Nym;
+}  // namespace identity
+
+class PasswordPrompt;
+
+/** A single signed change record in the journal of an OTCron or an OTMarket.
+ *
+ *  The meaning of the value, date, and payload fields depends on the type and
+ *  is defined by the owner of the journal. */
+class OTJournalEntry final : public Contract
+{
+public:
+    auto Date() const -> Time { return date_; }
+    auto Payload() const -> const String& { return payload_; }
+    auto Sequence() const -> std::int64_t { return sequence_; }
+    auto Type() const -> const String& { return type_; }
+    auto Value() const -> std::int64_t { return value_; }
+
+    auto Load(const char* szFoldername, const char* szFilename) -> bool
+    {
+        return LoadContract(szFoldername, szFilename);
+    }
+    /** return -1 if error, 0 if nothing, and 1 if the node was processed. */
+    auto ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t final;
+    void UpdateContents(const PasswordPrompt& reason) final;
+
+    explicit OTJournalEntry(const api::Session& api);
+    OTJournalEntry(
+        const api::Session& api,
+        const std::int64_t sequence,
+        const UnallocatedCString& type,
+        const std::int64_t value,
+        const Time date,
+        const String& payload);
+
+    ~OTJournalEntry() final;
+
+private:
+    std::int64_t sequence_;
+    OTString type_;
+    std::int64_t value_;
+    Time date_;
+    OTString payload_;
+
+    OTJournalEntry() = delete;
+};
+
+/** Append-only change journal stored next to a signed snapshot file.
+ *
+ *  Each entry is saved as its own signed file named after the snapshot and a
+ *  sequence number, so persisting a change costs O(1) regardless of the size
+ *  of the snapshot. The owner records Next() in every snapshot it writes and
+ *  passes that value to Replay() after loading the snapshot. */
+class OTJournal
+{
+public:
+    using Callback = std::function<bool(const OTJournalEntry&)>;
+
+    /** Number of entries after which the owner should write a new snapshot */
+    static constexpr std::int64_t snapshot_interval_{1000};
+
+    auto Next() const -> std::int64_t { return next_; }
+    auto SnapshotDue() const -> bool
+    {
+        return (next_ - first_) >= snapshot_interval_;
+    }
+
+    auto Append(
+        const identity::Nym& signer,
+        const PasswordPrompt& reason,
+        const UnallocatedCString& type,
+        const std::int64_t value = 0,
+        const Time date = {},
+        const String& payload = String::Factory()) -> bool;
+    /** Delete all entries which are included in a snapshot written at Next()
+     */
+    auto Compact() -> void;
+    auto Replay(
+        const std::int64_t first,
+        const identity::Nym& verifier,
+        const Callback& cb) -> bool;
+
+    OTJournal(
+        const api::Session& api,
+        const char* folder,
+        const UnallocatedCString& base);
+
+    ~OTJournal() = default;
+
+private:
+    const api::Session& api_;
+    const UnallocatedCString folder_;
+    const UnallocatedCString base_;
+    std::int64_t first_;
+    std::int64_t next_;
+
+    auto filename(const std::int64_t sequence) const -> UnallocatedCString;
+
+    OTJournal() = delete;
+    OTJournal(const OTJournal&) = delete;
+    OTJournal(OTJournal&&) = delete;
+    auto operator=(const OTJournal&) -> OTJournal& = delete;
+    auto operator=(OTJournal&&) -> OTJournal& = delete;
+};
+}  // namespace opentxs
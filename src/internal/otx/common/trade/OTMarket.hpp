@@ -7,9 +7,11 @@
 
 #include <irrxml/irrXML.hpp>
 #include <cstdint>
+#include <memory>
 
 #include "internal/otx/common/Contract.hpp"
 #include "internal/otx/common/cron/OTCron.hpp"
+#include "internal/otx/common/cron/OTJournal.hpp"
 #include "internal/otx/common/trade/OTOffer.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/api/session/Factory.hpp"
@@ -52,6 +54,7 @@ class Account;
 class Armored;
 class Identifier;
 class OTCron;
+class OTJournalEntry;
 class OTOffer;
 class OTTrade;
 class PasswordPrompt;
@@ -63,9 +66,13 @@ class PasswordPrompt;
 // Using multi-map since there will be more than one offer for each single
 // price.
 // (Map would only allow a single item on the map for each price.)
+// All the offers at one price form a price level, kept in the order they were
+// added to the market (see AddOffer.)
 using mapOfOffers = UnallocatedMultimap<Amount, OTOffer*>;
-// The same offers are also mapped (uniquely) to transaction number.
-using mapOfOffersTrnsNum = UnallocatedMap<Amount, OTOffer*>;
+// The same offers are also mapped (uniquely) to transaction number. The value
+// is the position of the offer on the bid or ask list, so an offer can be
+// removed without searching for it.
+using mapOfOffersTrnsNum = UnallocatedMap<std::int64_t, mapOfOffers::iterator>;
 
 // A market has a list of OTOffers for all the bids, and another list of
 // OTOffers for all the asks.
@@ -123,7 +130,10 @@ public:
     auto GetLowestAskPrice() -> Amount;
 
     auto GetBidCount() -> mapOfOffers::size_type { return m_mapBids.size(); }
-    auto GetAskCount() -> mapOfOffers::size_type { return m_mapAsks.size(); }
+    auto GetAskCount() -> mapOfOffers::size_type
+    {
+        return m_mapAsks.size() + m_mapMarketAsks.size();
+    }
     void SetInstrumentDefinitionID(
         const identifier::UnitDefinition& INSTRUMENT_DEFINITION_ID)
     {
@@ -181,7 +191,13 @@ public:
     inline void SetCronPointer(OTCron& theCron) { m_pCron = &theCron; }
     inline auto GetCron() -> OTCron* { return m_pCron; }
     auto LoadMarket() -> bool;
+    /** Writes a complete snapshot of the market. Individual changes should be
+     * persisted with SaveOffer instead. */
     auto SaveMarket(const PasswordPrompt& reason) -> bool;
+    /** Journals the current state of an offer which is already on the market.
+     */
+    auto SaveOffer(const OTOffer& theOffer, const PasswordPrompt& reason)
+        -> bool;
 
     void InitMarket();
 
@@ -209,6 +225,10 @@ private:
 
     mapOfOffers m_mapBids;  // The buyers, ordered by price limit
     mapOfOffers m_mapAsks;  // The sellers, ordered by price limit
+    // The sellers' market orders, in the order they were added. They have no
+    // price limit, so keeping them apart leaves the lowest priced ask at the
+    // front of m_mapAsks.
+    mapOfOffers m_mapMarketAsks;
 
     mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
                                      // ordered by transaction number.
@@ -234,6 +254,12 @@ private:
     Amount m_lLastSalePrice{0};
     UnallocatedCString m_strLastSaleDate;
 
+    // Changes made since the most recent snapshot.
+    std::unique_ptr<OTJournal> m_pJournal{nullptr};
+    // Sequence number of the first journal entry not included in the snapshot
+    // being loaded.
+    std::int64_t m_lJournalStart{0};
+
     // The server stores a map of markets, one for each unique combination of
     // instrument definitions. That's what this market class represents: one
     // instrument definition being traded and priced in another. It could be
@@ -254,6 +280,17 @@ private:
         const identifier::UnitDefinition& CURRENCY_TYPE_ID,
         const Amount& lScale);
 
+    auto journal() -> OTJournal&;
+    auto remove_offer(const std::int64_t& lTransactionNum) -> bool;
+    auto replay(const OTJournalEntry& entry) -> bool;
+    auto save_change(
+        const UnallocatedCString& type,
+        const std::int64_t value,
+        const Time date,
+        const String& payload,
+        const PasswordPrompt& reason) -> bool;
+    auto save_recent_trades() -> bool;
+
     void rollback_four_accounts(
         Account& p1,
         bool b1,
@@ -5,6 +5,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -22,10 +26,15 @@ namespace opentxs::internal
 class Log
 {
 public:
-    static auto Endpoint() noexcept -> const char*;
+    /// Receives formatted records on the log consumer thread
+    using Sink = std::function<
+        void(int level, std::string_view text, std::string_view thread)>;
+
+    /// Total number of records discarded because a producer ring was full
+    static auto Dropped() noexcept -> std::size_t;
     static auto SetVerbosity(const int level) noexcept -> void;
     static auto Shutdown() noexcept -> void;
-    static auto Start() noexcept -> void;
+    static auto Start(Sink&& sink) noexcept -> void;
 
     Log() = default;
 
@@ -236,6 +236,11 @@ auto Context::Start(BatchID id, StartArgs&& sockets) const noexcept
     return pool_.Start(id, std::move(sockets));
 }
 
+auto Context::Statistics() const noexcept -> PoolStatistics
+{
+    return pool_.Statistics();
+}
+
 auto Context::Stop(BatchID id) const noexcept -> std::future<bool>
 {
     return pool_.Stop(id);
@@ -144,6 +144,7 @@ public:
         -> OTZMQRouterSocket final;
     auto Start(BatchID id, StartArgs&& sockets) const noexcept
         -> internal::Thread* final;
+    auto Statistics() const noexcept -> PoolStatistics final;
     auto Stop(BatchID id) const noexcept -> std::future<bool> final;
     auto SubscribeSocket(const ListenCallback& callback) const noexcept
         -> OTZMQSubscribeSocket final;
@@ -8,8 +8,12 @@
 #include "network/zeromq/context/Pool.hpp"  // IWYU pragma: associated
 
 #include <zmq.h>  // IWYU pragma: keep
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <thread>
@@ -31,8 +35,20 @@ Pool::Pool(const Context& parent) noexcept
     , batches_()
     , batch_index_()
     , socket_index_()
+    , placement_()
+    , next_rebalance_(
+          (Clock::now() + rebalance_interval_).time_since_epoch().count())
+    , rebalance_lock_()
+    , rebalancer_()
 {
     for (unsigned int n{0}; n < count_; ++n) { threads_.try_emplace(n, *this); }
+
+    placement_.modify([this](auto& placement) {
+        placement.count_.resize(count_, 0u);
+        placement.utilization_.resize(count_, 0.0);
+    });
+    rebalancer_.last_ = Clock::now();
+    rebalancer_.busy_.resize(count_);
 }
 
 auto Pool::Alloc(BatchID id) noexcept -> alloc::Resource*
@@ -40,6 +56,17 @@ auto Pool::Alloc(BatchID id) noexcept -> alloc::Resource*
     return get(id).Alloc();
 }
 
+auto Pool::BatchOwner(BatchID id) const noexcept -> context::Thread*
+{
+    if (const auto index = owner(id); index.has_value()) {
+
+        return &const_cast<context::Thread&>(threads_.at(index.value()));
+    } else {
+
+        return nullptr;
+    }
+}
+
 auto Pool::BelongsToThreadPool(const std::thread::id id) const noexcept -> bool
 {
     auto alloc = alloc::BoostMonotonic{1024};
@@ -70,12 +97,42 @@ auto Pool::DoModify(SocketID id, const ModifyCallback& cb) noexcept -> bool
 
 auto Pool::get(BatchID id) const noexcept -> const context::Thread&
 {
-    return threads_.at(id % count_);
+    return const_cast<Pool*>(this)->get(id);
 }
 
 auto Pool::get(BatchID id) noexcept -> context::Thread&
 {
-    return threads_.at(id % count_);
+    return threads_.at(place(id));
+}
+
+auto Pool::index(const context::Thread& thread) const noexcept -> unsigned int
+{
+    for (const auto& [n, candidate] : threads_) {
+        if (&candidate == &thread) { return n; }
+    }
+
+    OT_FAIL;
+}
+
+auto Pool::least_loaded(const Placement& placement) noexcept -> unsigned int
+{
+    // NOTE weight the number of batches owned by each thread by its recent
+    // utilization so new batches avoid threads which are already busy without
+    // piling every new batch onto whichever thread happens to be idle
+    auto output = 0u;
+    auto best = std::numeric_limits<double>::max();
+
+    for (auto n = 0u; n < placement.count_.size(); ++n) {
+        const auto score = static_cast<double>(placement.count_[n]) *
+                           (1.0 + placement.utilization_[n]);
+
+        if (score < best) {
+            output = n;
+            best = score;
+        }
+    }
+
+    return output;
 }
 
 auto Pool::MakeBatch(Vector<socket::Type>&& types) noexcept -> internal::Handle
@@ -119,10 +176,144 @@ auto Pool::Modify(SocketID id, ModifyCallback cb) noexcept -> AsyncResult
     }
 }
 
+auto Pool::owner(BatchID id) const noexcept -> std::optional<unsigned int>
+{
+    auto placement = placement_.lock_shared();
+    const auto& map = placement->batches_;
+
+    if (auto i = map.find(id); map.end() != i) {
+
+        return i->second;
+    } else {
+
+        return std::nullopt;
+    }
+}
+
+auto Pool::place(BatchID id) noexcept -> unsigned int
+{
+    if (const auto index = owner(id); index.has_value()) {
+
+        return index.value();
+    }
+
+    auto placement = placement_.lock();
+    auto& map = placement->batches_;
+
+    if (auto i = map.find(id); map.end() != i) { return i->second; }
+
+    const auto index = least_loaded(*placement);
+    map.try_emplace(id, index);
+    ++placement->count_.at(index);
+
+    return index;
+}
+
 auto Pool::PreallocateBatch() const noexcept -> BatchID { return GetBatchID(); }
 
+auto Pool::Reassign(BatchID id, const context::Thread& target) noexcept
+    -> void
+{
+    const auto to = index(target);
+    auto placement = placement_.lock();
+    auto& map = placement->batches_;
+
+    if (auto i = map.find(id); map.end() != i) {
+        auto& from = i->second;
+        --placement->count_.at(from);
+        ++placement->count_.at(to);
+        from = to;
+    }
+}
+
+auto Pool::Rebalance() noexcept -> void
+{
+    const auto now = Clock::now();
+
+    if (now.time_since_epoch().count() < next_rebalance_.load()) { return; }
+
+    auto lock = std::unique_lock<std::mutex>{rebalance_lock_, std::defer_lock};
+
+    if (false == lock.try_lock()) { return; }
+
+    if (now.time_since_epoch().count() < next_rebalance_.load()) { return; }
+
+    const auto ticket = gate_.get();
+
+    if (ticket) { return; }
+
+    const auto next = now + rebalance_interval_;
+    next_rebalance_.store(next.time_since_epoch().count());
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        now - rebalancer_.last_);
+    rebalancer_.last_ = now;
+
+    if (0 >= elapsed.count()) { return; }
+
+    auto utilization = UnallocatedVector<double>(count_, 0.0);
+
+    for (auto n = 0u; n < count_; ++n) {
+        const auto busy = threads_.at(n).Busy();
+        auto& previous = rebalancer_.busy_.at(n);
+        utilization[n] = std::min(
+            static_cast<double>((busy - previous).count()) /
+                static_cast<double>(elapsed.count()),
+            1.0);
+        previous = busy;
+    }
+
+    placement_.modify(
+        [&](auto& placement) { placement.utilization_ = utilization; });
+    const auto [cold, hot] =
+        std::minmax_element(utilization.begin(), utilization.end());
+    const auto difference = *hot - *cold;
+
+    if ((hot_threshold_ > *hot) || (imbalance_threshold_ > difference)) {
+        return;
+    }
+
+    // NOTE ask the busiest thread to give up a batch which accounts for no
+    // more than half of the difference between it and the least busy thread
+    const auto share = difference / (2.0 * *hot);
+    auto& source = threads_.at(
+        static_cast<unsigned int>(std::distance(utilization.begin(), hot)));
+    auto& target = threads_.at(
+        static_cast<unsigned int>(std::distance(utilization.begin(), cold)));
+    source.Shed(share, target);
+}
+
 auto Pool::Shutdown() noexcept -> void { stop(); }
 
+auto Pool::SocketOwner(SocketID id) const noexcept -> context::Thread*
+{
+    try {
+        const auto batch = [&] {
+            auto socket_index = socket_index_.lock_shared();
+
+            return socket_index->at(id).first;
+        }();
+
+        return BatchOwner(batch);
+    } catch (...) {
+
+        return nullptr;
+    }
+}
+
+auto Pool::Statistics() const noexcept -> PoolStatistics
+{
+    auto output = PoolStatistics{};
+    output.reserve(count_);
+    const auto utilization = placement_.lock_shared()->utilization_;
+
+    for (auto n = 0u; n < count_; ++n) {
+        auto& stats = output.emplace_back(threads_.at(n).Stats());
+        stats.utilization_ = utilization.at(n);
+    }
+
+    return output;
+}
+
 auto Pool::Start(BatchID id, StartArgs&& sockets) noexcept
     -> zeromq::internal::Thread*
 {
@@ -187,6 +378,7 @@ auto Pool::stop() noexcept -> void
         batches_.modify([](auto& map) { map.clear(); });
         batch_index_.modify([](auto& map) { map.clear(); });
         socket_index_.modify([](auto& map) { map.clear(); });
+        placement_.modify([](auto& placement) { placement.batches_.clear(); });
     }
 }
 
@@ -237,6 +429,14 @@ auto Pool::UpdateIndex(BatchID id) noexcept -> void
     });
 
     batches_.modify([&](auto& batch) { batch.erase(id); });
+    placement_.modify([&](auto& placement) {
+        auto& map = placement.batches_;
+
+        if (auto i = map.find(id); map.end() != i) {
+            --placement.count_.at(i->second);
+            map.erase(i);
+        }
+    });
 }
 
 Pool::~Pool() { stop(); }
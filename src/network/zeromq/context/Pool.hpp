@@ -6,8 +6,11 @@
 #include <cs_ordered_guarded.h>
 #include <robin_hood.h>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <future>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <thread>
 #include <tuple>
@@ -68,15 +71,28 @@ using BatchIndex = robin_hood::unordered_node_map<BatchID, Vector<SocketID>>;
 using SocketIndex =
     robin_hood::unordered_node_map<SocketID, std::pair<BatchID, socket::Raw*>>;
 
+struct Placement {
+    // Index of the thread which owns each batch
+    robin_hood::unordered_flat_map<BatchID, unsigned int> batches_{};
+    // Number of batches owned by each thread
+    UnallocatedVector<std::size_t> count_{};
+    // Fraction of time each thread spent in callbacks during the most recent
+    // rebalancing interval
+    UnallocatedVector<double> utilization_{};
+};
+
 class Pool final : public zeromq::internal::Pool
 {
 public:
+    auto BatchOwner(BatchID id) const noexcept -> context::Thread*;
     auto BelongsToThreadPool(const std::thread::id) const noexcept
         -> bool final;
     auto Parent() const noexcept -> const zeromq::Context& final
     {
         return parent_;
     }
+    auto SocketOwner(SocketID id) const noexcept -> context::Thread*;
+    auto Statistics() const noexcept -> PoolStatistics;
     auto Thread(BatchID id) const noexcept -> zeromq::internal::Thread* final;
     auto ThreadID(BatchID id) const noexcept -> std::thread::id final;
 
@@ -87,6 +103,8 @@ public:
     auto Modify(SocketID id, ModifyCallback cb) noexcept -> AsyncResult;
     auto DoModify(SocketID id, const ModifyCallback& cb) noexcept -> bool final;
     auto PreallocateBatch() const noexcept -> BatchID final;
+    auto Reassign(BatchID id, const context::Thread& target) noexcept -> void;
+    auto Rebalance() noexcept -> void;
     auto Shutdown() noexcept -> void final;
     auto Start(BatchID id, StartArgs&& sockets) noexcept
         -> zeromq::internal::Thread*;
@@ -99,6 +117,21 @@ public:
     ~Pool() final;
 
 private:
+    using Clock = std::chrono::steady_clock;
+
+    // Time between checks for imbalanced threads
+    static constexpr auto rebalance_interval_ = std::chrono::seconds{1};
+    // Minimum utilization of the busiest thread before any batch is moved
+    static constexpr auto hot_threshold_ = 0.5;
+    // Minimum difference in utilization between the busiest and the least
+    // busy threads before any batch is moved
+    static constexpr auto imbalance_threshold_ = 0.25;
+
+    struct Rebalancer {
+        Clock::time_point last_{};
+        UnallocatedVector<std::chrono::nanoseconds> busy_{};
+    };
+
     const Context& parent_;
     const unsigned int count_;
     std::atomic<bool> running_;
@@ -107,10 +140,20 @@ private:
     libguarded::ordered_guarded<Batches, std::shared_mutex> batches_;
     libguarded::ordered_guarded<BatchIndex, std::shared_mutex> batch_index_;
     libguarded::ordered_guarded<SocketIndex, std::shared_mutex> socket_index_;
+    libguarded::ordered_guarded<Placement, std::shared_mutex> placement_;
+    std::atomic<Clock::rep> next_rebalance_;
+    std::mutex rebalance_lock_;
+    Rebalancer rebalancer_;
+
+    static auto least_loaded(const Placement& placement) noexcept
+        -> unsigned int;
 
     auto get(BatchID id) const noexcept -> const context::Thread&;
+    auto index(const context::Thread& thread) const noexcept -> unsigned int;
+    auto owner(BatchID id) const noexcept -> std::optional<unsigned int>;
 
     auto get(BatchID id) noexcept -> context::Thread&;
+    auto place(BatchID id) noexcept -> unsigned int;
     auto stop() noexcept -> void;
 
     Pool() = delete;
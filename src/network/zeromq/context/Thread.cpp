@@ -19,14 +19,15 @@
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <utility>
 
-#include "internal/network/zeromq/Pool.hpp"
 #include "internal/network/zeromq/socket/Factory.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Signals.hpp"
+#include "network/zeromq/context/Pool.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/util/Container.hpp"
@@ -36,8 +37,9 @@
 
 namespace opentxs::network::zeromq::context
 {
-Thread::Thread(zeromq::internal::Pool& parent) noexcept
+Thread::Thread(Pool& parent, std::size_t budget) noexcept
     : parent_(parent)
+    , budget_(std::max(budget, std::size_t{1}))
     , shutdown_(false)
     , null_(factory::ZMQSocketNull())
     , alloc_()
@@ -45,6 +47,8 @@ Thread::Thread(zeromq::internal::Pool& parent) noexcept
     , thread_()
     , data_(&alloc_)
     , idle_(true)
+    , counters_()
+    , spin_until_()
 {
 }
 
@@ -66,23 +70,56 @@ auto Thread::Add(BatchID id, StartArgs&& args) noexcept -> bool
         return out;
     }();
     parent_.UpdateIndex(id, std::move(args));
-    data_.modify_detach([data = std::move(sockets)](auto& guarded) {
+    data_.modify_detach([this, id, data = std::move(sockets)](auto& guarded) {
         for (auto [socket, cb] : data) {
             assert(cb);
 
             guarded.data_.emplace_back(std::move(cb));
+            guarded.batches_.emplace_back(id);
             auto& s = guarded.items_.emplace_back();
             s.socket = socket->Native();
             s.events = ZMQ_POLLIN;
 
             assert(guarded.items_.size() == guarded.data_.size());
+            assert(guarded.items_.size() == guarded.batches_.size());
         }
+
+        guarded.load_.try_emplace(id);
+        update_counters(guarded);
     });
     start();
 
     return true;
 }
 
+auto Thread::Attach(BatchID id, Detached&& items) noexcept -> void
+{
+    const auto ticket = gate_.get();
+
+    if (ticket) { return; }
+
+    data_.modify_detach([this, id, data = std::move(items)](auto& guarded) {
+        for (const auto& [item, cb] : data) {
+            guarded.items_.emplace_back(item);
+            guarded.data_.emplace_back(cb);
+            guarded.batches_.emplace_back(id);
+        }
+
+        assert(guarded.items_.size() == guarded.data_.size());
+        assert(guarded.items_.size() == guarded.batches_.size());
+
+        guarded.load_.try_emplace(id);
+        update_counters(guarded);
+    });
+    start();
+}
+
+auto Thread::Busy() const noexcept -> std::chrono::nanoseconds
+{
+    return std::chrono::nanoseconds{
+        counters_.busy_.load(std::memory_order_relaxed)};
+}
+
 auto Thread::join() noexcept -> void
 {
     if (thread_.handle_.joinable()) { thread_.handle_.join(); }
@@ -102,6 +139,16 @@ auto Thread::Modify(SocketID socket, ModifyCallback cb) noexcept -> AsyncResult
 
     auto promise = std::make_shared<std::promise<bool>>();
     auto output = std::make_pair(true, promise->get_future());
+    modify(socket, std::move(cb), std::move(promise));
+
+    return output;
+}
+
+auto Thread::modify(
+    SocketID socket,
+    ModifyCallback cb,
+    std::shared_ptr<std::promise<bool>> promise) noexcept -> void
+{
     data_.modify_detach([=](auto& data) {
         if (null_.ID() == socket) {
             try {
@@ -110,12 +157,15 @@ auto Thread::Modify(SocketID socket, ModifyCallback cb) noexcept -> AsyncResult
             } catch (...) {
                 promise->set_value(false);
             }
+        } else if (auto* owner = parent_.SocketOwner(socket);
+                   (nullptr != owner) && (this != owner)) {
+            // NOTE the batch which owns this socket was moved to another
+            // thread after the callback was queued
+            owner->modify(socket, cb, promise);
         } else {
             promise->set_value(parent_.DoModify(socket, cb));
         }
     });
-
-    return output;
 }
 
 auto Thread::poll(Items& data) noexcept -> void
@@ -128,7 +178,11 @@ auto Thread::poll(Items& data) noexcept -> void
         return;
     }
 
-    static constexpr auto timeout = 100ms;
+    // NOTE after a wakeup which delivered messages, poll without blocking for
+    // a short time since more messages are likely to arrive soon
+    const auto timeout = (SpinClock::now() < spin_until_)
+                             ? std::chrono::milliseconds{0}
+                             : blocking_timeout_;
     const auto events = ::zmq_poll(
         data.items_.data(),
         static_cast<int>(data.items_.size()),
@@ -146,27 +200,63 @@ auto Thread::poll(Items& data) noexcept -> void
 
     const auto& v = data.items_;
     auto c = data.data_.begin();
+    auto b = data.batches_.begin();
+    auto received = std::size_t{0};
+    auto backlog = std::size_t{0};
+    auto busy = std::chrono::nanoseconds{0};
 
-    for (auto s = v.begin(), end = v.end(); s != end; ++s, ++c) {
+    for (auto s = v.begin(), end = v.end(); s != end; ++s, ++c, ++b) {
         auto& item = *s;
 
         if (ZMQ_POLLIN != item.revents) { continue; }
 
         auto& socket = item.socket;
-        auto message = Message{};
+        const auto& callback = *c;
+        auto count = std::size_t{0};
+        const auto started = SpinClock::now();
+
+        // NOTE drain the socket up to the budget rather than returning to
+        // zmq_poll after every message
+        while (count < budget_) {
+            auto message = Message{};
+
+            if (false == receive_message(socket, message, 0u == count)) {
+                break;
+            }
 
-        if (receive_message(socket, message)) {
-            const auto& callback = *c;
+            ++count;
 
             try {
                 callback(std::move(message));
             } catch (...) {
             }
         }
+
+        const auto elapsed = SpinClock::now() - started;
+        data.load_[*b] += elapsed;
+        busy += elapsed;
+        received += count;
+
+        if (budget_ == count) { ++backlog; }
+    }
+
+    counters_.wakeups_.fetch_add(1u, std::memory_order_relaxed);
+    counters_.messages_.fetch_add(received, std::memory_order_relaxed);
+    counters_.last_batch_.store(received, std::memory_order_relaxed);
+    counters_.backlog_.store(backlog, std::memory_order_relaxed);
+    counters_.busy_.fetch_add(busy.count(), std::memory_order_relaxed);
+
+    if (received > counters_.max_batch_.load(std::memory_order_relaxed)) {
+        counters_.max_batch_.store(received, std::memory_order_relaxed);
     }
+
+    if (0u < received) { spin_until_ = SpinClock::now() + spin_time_; }
 }
 
-auto Thread::receive_message(void* socket, Message& message) noexcept -> bool
+auto Thread::receive_message(
+    void* socket,
+    Message& message,
+    bool expected) noexcept -> bool
 {
     bool receiving{true};
 
@@ -178,10 +268,14 @@ auto Thread::receive_message(void* socket, Message& message) noexcept -> bool
         if (false == received) {
             auto zerr = ::zmq_errno();
             if (EAGAIN == zerr) {
-                std::cerr
-                    << (OT_PRETTY_CLASS())
-                    << "zmq_msg_recv returns EAGAIN. This should never happen."
-                    << std::endl;
+                // NOTE running out of messages while draining a socket is
+                // normal, but zmq_poll reported at least one was waiting
+                if (expected) {
+                    std::cerr << (OT_PRETTY_CLASS())
+                              << "zmq_msg_recv returns EAGAIN. This should "
+                                 "never happen."
+                              << std::endl;
+                }
             } else {
                 std::cerr << (OT_PRETTY_CLASS())
                           << ": Receive error: " << ::zmq_strerror(zerr)
@@ -191,24 +285,10 @@ auto Thread::receive_message(void* socket, Message& message) noexcept -> bool
             return false;
         }
 
-        int option{0};
-        std::size_t optionBytes{sizeof(option)};
-
-        const bool haveOption =
-            (-1 !=
-             ::zmq_getsockopt(socket, ZMQ_RCVMORE, &option, &optionBytes));
-
-        if (false == haveOption) {
-            std::cerr << (OT_PRETTY_CLASS())
-                      << "Failed to check socket options error:\n"
-                      << ::zmq_strerror(zmq_errno()) << std::endl;
-
-            return false;
-        }
-
-        assert(optionBytes == sizeof(option));
-
-        if (1 != option) { receiving = false; }
+        // NOTE only the first frame of a message may be missing. Once it has
+        // arrived the remaining frames are guaranteed to be available.
+        expected = true;
+        receiving = (0 != ::zmq_msg_more(frame));
     }
 
     return true;
@@ -219,9 +299,28 @@ auto Thread::Remove(BatchID id, UnallocatedVector<socket::Raw*>&& data) noexcept
 {
     auto p = std::make_shared<std::promise<bool>>();
     auto future = p->get_future();
+    remove(id, std::move(data), std::move(p));
+
+    return future;
+}
+
+auto Thread::remove(
+    BatchID id,
+    UnallocatedVector<socket::Raw*>&& data,
+    std::shared_ptr<std::promise<bool>> p) noexcept -> void
+{
     data_.modify_detach(
         [this, id, sockets = std::move(data), promise = std::move(p)](
-            auto& guarded) {
+            auto& guarded) mutable {
+            if (auto* owner = parent_.BatchOwner(id);
+                (nullptr != owner) && (this != owner)) {
+                // NOTE the batch was moved to another thread after the
+                // request was queued
+                owner->remove(id, std::move(sockets), std::move(promise));
+
+                return;
+            }
+
             const auto set = [&] {
                 auto out = UnallocatedSet<void*>{};
                 std::transform(
@@ -234,6 +333,7 @@ auto Thread::Remove(BatchID id, UnallocatedVector<socket::Raw*>&& data) noexcept
             }();
             auto s = guarded.items_.begin();
             auto c = guarded.data_.begin();
+            auto b = guarded.batches_.begin();
 
             while ((s != guarded.items_.end()) && (c != guarded.data_.end())) {
                 auto* socket = s->socket;
@@ -241,19 +341,22 @@ auto Thread::Remove(BatchID id, UnallocatedVector<socket::Raw*>&& data) noexcept
                 if (0u == set.count(socket)) {
                     ++s;
                     ++c;
+                    ++b;
                 } else {
                     s = guarded.items_.erase(s);
                     c = guarded.data_.erase(c);
+                    b = guarded.batches_.erase(b);
                 }
             }
 
             assert(guarded.items_.size() == guarded.data_.size());
+            assert(guarded.items_.size() == guarded.batches_.size());
 
+            guarded.load_.erase(id);
+            update_counters(guarded);
             parent_.UpdateIndex(id);
             promise->set_value(true);
         });
-
-    return future;
 }
 
 auto Thread::run() noexcept -> void
@@ -263,6 +366,7 @@ auto Thread::run() noexcept -> void
     while (thread_.running_) {
         if (auto idle = idle_.exchange(false); idle) {
             data_.modify_detach([this](auto& data) { poll(data); });
+            parent_.Rebalance();
         } else {
             using namespace std::literals;
             Sleep(10us);
@@ -270,16 +374,106 @@ auto Thread::run() noexcept -> void
     }
 }
 
+auto Thread::Shed(double share, Thread& target) noexcept -> void
+{
+    const auto ticket = gate_.get();
+
+    if (ticket) { return; }
+
+    data_.modify_detach([this, share, &target](auto& data) {
+        auto post = ScopeGuard{[&] {
+            for (auto& [batch, time] : data.load_) { time = {}; }
+        }};
+
+        if (2u > data.load_.size()) { return; }
+
+        const auto total = [&] {
+            auto out = std::chrono::nanoseconds{0};
+
+            for (const auto& [batch, time] : data.load_) { out += time; }
+
+            return out;
+        }();
+        const auto limit = share * static_cast<double>(total.count());
+        // NOTE move the busiest batch which does not exceed the requested
+        // share of this thread's load. Moving a batch which dominates the
+        // thread would only relocate the imbalance instead of reducing it.
+        const auto selected = [&] {
+            auto out = std::optional<BatchID>{};
+            auto best = std::chrono::nanoseconds{0};
+
+            for (const auto& [batch, time] : data.load_) {
+                if ((time > best) &&
+                    (static_cast<double>(time.count()) <= limit)) {
+                    out = batch;
+                    best = time;
+                }
+            }
+
+            return out;
+        }();
+
+        if (false == selected.has_value()) { return; }
+
+        const auto id = selected.value();
+        auto items = Detached{};
+        auto s = data.items_.begin();
+        auto c = data.data_.begin();
+        auto b = data.batches_.begin();
+
+        while (s != data.items_.end()) {
+            if (id == *b) {
+                items.emplace_back(*s, std::move(*c));
+                s = data.items_.erase(s);
+                c = data.data_.erase(c);
+                b = data.batches_.erase(b);
+            } else {
+                ++s;
+                ++c;
+                ++b;
+            }
+        }
+
+        data.load_.erase(id);
+        update_counters(data);
+        counters_.migrated_.fetch_add(1u, std::memory_order_relaxed);
+        // NOTE the sockets must be queued on the new thread before the
+        // placement changes so that any request routed to the new owner is
+        // processed after the sockets arrive
+        target.Attach(id, std::move(items));
+        parent_.Reassign(id, target);
+    });
+}
+
 auto Thread::Shutdown() noexcept -> void
 {
     shutdown_ = true;
     data_.modify_detach([](auto& data) {
         data.items_.clear();
         data.data_.clear();
+        data.batches_.clear();
+        data.load_.clear();
     });
     wait();
 }
 
+auto Thread::Stats() const noexcept -> Statistics
+{
+    auto output = Statistics{};
+    output.id_ = ID();
+    output.wakeups_ = counters_.wakeups_.load(std::memory_order_relaxed);
+    output.messages_ = counters_.messages_.load(std::memory_order_relaxed);
+    output.last_batch_ = counters_.last_batch_.load(std::memory_order_relaxed);
+    output.max_batch_ = counters_.max_batch_.load(std::memory_order_relaxed);
+    output.backlog_ = counters_.backlog_.load(std::memory_order_relaxed);
+    output.busy_ = Busy();
+    output.batches_ = counters_.batches_.load(std::memory_order_relaxed);
+    output.sockets_ = counters_.sockets_.load(std::memory_order_relaxed);
+    output.migrated_ = counters_.migrated_.load(std::memory_order_relaxed);
+
+    return output;
+}
+
 auto Thread::start() noexcept -> void
 {
     if (auto running = thread_.running_.exchange(true); false == running) {
@@ -288,6 +482,12 @@ auto Thread::start() noexcept -> void
     }
 }
 
+auto Thread::update_counters(const Items& data) noexcept -> void
+{
+    counters_.batches_.store(data.load_.size(), std::memory_order_relaxed);
+    counters_.sockets_.store(data.items_.size(), std::memory_order_relaxed);
+}
+
 auto Thread::wait() noexcept -> void
 {
     gate_.shutdown();
@@ -8,7 +8,11 @@
 #include <cs_deferred_guarded.h>
 #include <zmq.h>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <shared_mutex>
@@ -36,9 +40,13 @@ namespace network
 {
 namespace zeromq
 {
-namespace internal
+namespace context
 {
 class Pool;
+}  // namespace context
+
+namespace internal
+{
 class Thread;
 }  // namespace internal
 
@@ -59,19 +67,33 @@ namespace opentxs::network::zeromq::context
 class Thread final : public zeromq::internal::Thread
 {
 public:
-    auto Add(BatchID id, StartArgs&& args) noexcept -> bool;
-    auto Alloc() noexcept -> alloc::Resource* final { return &alloc_; }
+    using Statistics = ThreadStatistics;
+    // Sockets belonging to a single batch which are being moved between
+    // threads, along with their receive callbacks
+    using Detached =
+        UnallocatedVector<std::pair<::zmq_pollitem_t, ReceiveCallback>>;
+
+    // Maximum number of messages received from one socket per wakeup
+    static constexpr auto default_receive_budget_ = std::size_t{64};
+
+    auto Busy() const noexcept -> std::chrono::nanoseconds;
     auto ID() const noexcept -> std::thread::id final
     {
         return thread_.handle_.get_id();
     }
+    auto Stats() const noexcept -> Statistics;
+
+    auto Add(BatchID id, StartArgs&& args) noexcept -> bool;
+    auto Alloc() noexcept -> alloc::Resource* final { return &alloc_; }
+    auto Attach(BatchID id, Detached&& items) noexcept -> void;
     auto Modify(SocketID socket, ModifyCallback cb) noexcept
         -> AsyncResult final;
     auto Remove(BatchID id, UnallocatedVector<socket::Raw*>&& sockets) noexcept
         -> std::future<bool>;
+    auto Shed(double share, Thread& target) noexcept -> void;
     auto Shutdown() noexcept -> void final;
 
-    Thread(zeromq::internal::Pool& parent) noexcept;
+    Thread(Pool& parent, std::size_t budget = default_receive_budget_) noexcept;
 
     ~Thread() final;
 
@@ -83,22 +105,47 @@ private:
     struct Items {
         using ItemVector = Vector<::zmq_pollitem_t>;
         using DataVector = Vector<ReceiveCallback>;
+        using BatchVector = Vector<BatchID>;
+        using LoadMap = Map<BatchID, std::chrono::nanoseconds>;
 
         ItemVector items_;
         DataVector data_;
+        BatchVector batches_;
+        // NOTE time spent in the callbacks of each batch since the last time
+        // the thread was asked to shed load
+        LoadMap load_;
 
         Items(alloc::Resource* alloc) noexcept
             : items_(alloc)
             , data_(alloc)
+            , batches_(alloc)
+            , load_(alloc)
         {
         }
 
         ~Items();
     };
 
+    struct Counters {
+        std::atomic<std::uint64_t> wakeups_{0};
+        std::atomic<std::uint64_t> messages_{0};
+        std::atomic<std::size_t> last_batch_{0};
+        std::atomic<std::size_t> max_batch_{0};
+        std::atomic<std::size_t> backlog_{0};
+        std::atomic<std::int64_t> busy_{0};
+        std::atomic<std::size_t> batches_{0};
+        std::atomic<std::size_t> sockets_{0};
+        std::atomic<std::uint64_t> migrated_{0};
+    };
+
     using Data = libguarded::deferred_guarded<Items, std::shared_mutex>;
+    using SpinClock = std::chrono::steady_clock;
+
+    static constexpr auto blocking_timeout_ = std::chrono::milliseconds{100};
+    static constexpr auto spin_time_ = std::chrono::microseconds{200};
 
-    zeromq::internal::Pool& parent_;
+    Pool& parent_;
+    const std::size_t budget_;
     std::atomic_bool shutdown_;
     socket::Raw null_;
     alloc::BoostPoolSync alloc_;
@@ -106,12 +153,26 @@ private:
     Background thread_;
     Data data_;
     std::atomic<bool> idle_;
+    Counters counters_;
+    SpinClock::time_point spin_until_;
 
     auto join() noexcept -> void;
+    auto modify(
+        SocketID socket,
+        ModifyCallback cb,
+        std::shared_ptr<std::promise<bool>> promise) noexcept -> void;
     auto poll(Items& data) noexcept -> void;
-    auto receive_message(void* socket, Message& message) noexcept -> bool;
+    auto receive_message(
+        void* socket,
+        Message& message,
+        bool expected) noexcept -> bool;
+    auto remove(
+        BatchID id,
+        UnallocatedVector<socket::Raw*>&& sockets,
+        std::shared_ptr<std::promise<bool>> promise) noexcept -> void;
     auto run() noexcept -> void;
     auto start() noexcept -> void;
+    auto update_counters(const Items& data) noexcept -> void;
     auto wait() noexcept -> void;
 
     Thread() = delete;
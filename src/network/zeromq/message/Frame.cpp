@@ -16,9 +16,40 @@
 
 #include "internal/network/zeromq/message/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Allocator.hpp"
 
 namespace opentxs::factory
 {
+namespace
+{
+template <typename Owner>
+auto release_zmq_frame(void*, void* hint) noexcept -> void
+{
+    std::unique_ptr<Owner>{static_cast<Owner*>(hint)};
+}
+
+template <typename Owner>
+auto adopt_zmq_frame(Owner&& owner, const ReadView bytes) noexcept
+    -> network::zeromq::Frame
+{
+    using ReturnType = network::zeromq::Frame;
+
+    if (ReturnType::Imp::minimum_adopt_size_ > bytes.size()) {
+
+        return ZMQFrame(bytes.data(), bytes.size());
+    }
+
+    auto hint = std::make_unique<Owner>(std::move(owner));
+
+    return std::make_unique<ReturnType::Imp>(
+               const_cast<char*>(bytes.data()),
+               bytes.size(),
+               &release_zmq_frame<Owner>,
+               hint.release())
+        .release();
+}
+}  // namespace
+
 auto ZMQFrame(const std::size_t size) noexcept -> network::zeromq::Frame
 {
     using ReturnType = network::zeromq::Frame;
@@ -40,6 +71,35 @@ auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame
 
     return std::make_unique<ReturnType::Imp>(data).release();
 }
+
+auto ZMQFrame(Space&& data) noexcept -> network::zeromq::Frame
+{
+    const auto bytes = reader(data);
+
+    // NOTE moving a vector does not relocate its elements so bytes remains
+    // valid for the adopted copy
+    return adopt_zmq_frame(std::move(data), bytes);
+}
+
+auto ZMQFrame(Vector<std::byte>&& data) noexcept -> network::zeromq::Frame
+{
+    const auto bytes = reader(data);
+
+    if (data.get_allocator().resource() != alloc::System()) {
+
+        return ZMQFrame(bytes.data(), bytes.size());
+    }
+
+    return adopt_zmq_frame(std::move(data), bytes);
+}
+
+auto ZMQFrame(std::shared_ptr<const void> owner, const ReadView bytes) noexcept
+    -> network::zeromq::Frame
+{
+    if (!owner) { return ZMQFrame(bytes.data(), bytes.size()); }
+
+    return adopt_zmq_frame(std::move(owner), bytes);
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::network::zeromq
@@ -54,6 +114,20 @@ auto operator==(const Frame& lhs, const Frame& rhs) noexcept -> bool
     return lhs.imp_->operator==(rhs);
 }
 
+Frame::Imp::Imp(
+    void* data,
+    std::size_t size,
+    ::zmq_free_fn* release,
+    void* hint) noexcept
+    : message_()
+{
+    OT_ASSERT(size <= std::numeric_limits<int>::max());
+
+    const auto init = ::zmq_msg_init_data(&message_, data, size, release, hint);
+
+    OT_ASSERT(0 == init);
+}
+
 Frame::Imp::Imp(const void* data, std::size_t size) noexcept
     : message_()
 {
@@ -84,8 +158,13 @@ Frame::Imp::Imp(const ProtobufType& input) noexcept
 }
 
 Frame::Imp::Imp(const Imp& rhs) noexcept
-    : Imp(rhs.data(), rhs.size())
+    : Imp()
 {
+    // NOTE frames are never modified after construction so the copy can
+    // share the reference counted payload of rhs instead of duplicating it
+    const auto copy = ::zmq_msg_copy(&message_, &rhs.message_);
+
+    OT_ASSERT(0 == copy);
 }
 
 auto Frame::Imp::operator<(const zeromq::Frame& rhs) const noexcept -> bool
@@ -41,8 +41,16 @@ public:
 
     auto data() noexcept -> void* { return ::zmq_msg_data(&message_); }
 
+    // NOTE smaller payloads are copied instead of adopted since tracking the
+    // ownership of an adopted buffer costs more than copying a few bytes
+    static constexpr auto minimum_adopt_size_ = std::size_t{1024};
+
     mutable zmq_msg_t message_;
 
+    Imp(void* data,
+        std::size_t size,
+        ::zmq_free_fn* release,
+        void* hint) noexcept;
     Imp(const void* data, std::size_t size) noexcept;
     Imp(std::size_t size) noexcept;
     Imp() noexcept;
@@ -135,6 +135,11 @@ auto Message::Imp::AddFrame(const Amount& amount) noexcept -> Frame&
     return frames_.back();
 }
 
+auto Message::Imp::AddFrame(const Frame& frame) noexcept -> Frame&
+{
+    return frames_.emplace_back(frame);
+}
+
 auto Message::Imp::AddFrame(Frame&& frame) noexcept -> Frame&
 {
     return frames_.emplace_back(std::move(frame));
@@ -152,6 +157,11 @@ auto Message::Imp::AddFrame(const ReadView bytes) noexcept -> Frame&
     return AddFrame(bytes.data(), bytes.size());
 }
 
+auto Message::Imp::AddFrame(Space&& input) noexcept -> Frame&
+{
+    return frames_.emplace_back(factory::ZMQFrame(std::move(input)));
+}
+
 auto Message::Imp::AddFrame(const void* input, const std::size_t size) noexcept
     -> Frame&
 {
@@ -469,11 +479,21 @@ auto Message::AddFrame(const char* in) noexcept -> Frame&
     return imp_->AddFrame(in);
 }
 
+auto Message::AddFrame(const Frame& frame) noexcept -> Frame&
+{
+    return imp_->AddFrame(frame);
+}
+
 auto Message::AddFrame(Frame&& frame) noexcept -> Frame&
 {
     return imp_->AddFrame(std::move(frame));
 }
 
+auto Message::AddFrame(Space&& input) noexcept -> Frame&
+{
+    return imp_->AddFrame(std::move(input));
+}
+
 auto Message::AddFrame(const void* input, const std::size_t size) noexcept
     -> Frame&
 {
@@ -49,10 +49,12 @@ public:
 
     auto AddFrame() noexcept -> Frame&;
     auto AddFrame(const Amount& amount) noexcept -> Frame&;
+    auto AddFrame(const Frame& frame) noexcept -> Frame&;
     auto AddFrame(Frame&& frame) noexcept -> Frame&;
     auto AddFrame(const char* in) noexcept -> Frame&;
     auto AddFrame(const ProtobufType& input) noexcept -> Frame& final;
     auto AddFrame(const ReadView bytes) noexcept -> Frame&;
+    auto AddFrame(Space&& input) noexcept -> Frame&;
     auto AddFrame(const void* input, const std::size_t size) noexcept -> Frame&;
     auto AppendBytes() noexcept -> AllocateOutput;
     auto at(const std::size_t index) -> Frame&;
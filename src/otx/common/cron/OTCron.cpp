@@ -7,9 +7,11 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "internal/otx/common/cron/OTCron.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <sstream>
 #include <utility>
 
 #include "internal/api/Legacy.hpp"
@@ -19,6 +21,7 @@
 #include "internal/otx/common/StringXML.hpp"
 #include "internal/otx/common/XML.hpp"
 #include "internal/otx/common/cron/OTCronItem.hpp"
+#include "internal/otx/common/cron/OTJournal.hpp"
 #include "internal/otx/common/trade/OTMarket.hpp"
 #include "internal/otx/common/util/Common.hpp"
 #include "internal/otx/common/util/Tag.hpp"
@@ -60,11 +63,15 @@ OTCron::OTCron(const api::Session& server)
     , m_mapMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
+    , m_setSchedule()
+    , m_mapCronIndex()
     , m_NOTARY_ID(api_.Factory().ServerID())
     , m_listTransactionNumbers()
     , m_bIsActivated(false)
     , m_pServerNym(nullptr)  // just here for convenience, not responsible to
                              // cleanup this pointer.
+    , m_journal(server, server.Internal().Legacy().Cron(), "OT-CRON.crn")
+    , m_lJournalStart(0)
 {
     InitCron();
     LogDebug()(OT_PRETTY_CLASS())("Finished calling InitCron 0.").Flush();
@@ -84,6 +91,14 @@ auto OTCron::LoadCron() -> bool
 
     if (bSuccess) bSuccess = VerifySignature(*(GetServerNym()));
 
+    // Apply the changes which were journaled after the snapshot was saved.
+    if (bSuccess) {
+        bSuccess = m_journal.Replay(
+            m_lJournalStart, *GetServerNym(), [this](const auto& entry) {
+                return replay(entry);
+            });
+    }
+
     return bSuccess;
 }
 
@@ -105,8 +120,120 @@ auto OTCron::SaveCron() -> bool
             szFoldername)(api::Legacy::PathSeparator())(szFilename)(".")
             .Flush();
         return false;
-    } else
+    }
+
+    // Every journal entry written so far is included in this snapshot.
+    m_journal.Compact();
+
+    return true;
+}
+
+auto OTCron::SaveCronItem(const OTCronItem& theItem) -> bool
+{
+    const auto lTransactionNum = theItem.GetTransactionNum();
+    const auto it = FindItemOnMultimap(lTransactionNum);
+
+    if (m_multimapCronItems.end() == it) {
+        LogError()(OT_PRETTY_CLASS())("Cron item ")(
+            lTransactionNum)(" is not on Cron.")
+            .Flush();
+
+        return false;
+    }
+
+    return save_change(
+        "update", lTransactionNum, it->first, String::Factory(theItem));
+}
+
+auto OTCron::SaveTransactionNumbers() -> bool
+{
+    auto numbers = std::stringstream{};
+
+    for (const auto& lTransactionNumber : m_listTransactionNumbers) {
+        numbers << lTransactionNumber << ' ';
+    }
+
+    return save_change("numbers", 0, {}, String::Factory(numbers.str()));
+}
+
+auto OTCron::save_change(
+    const UnallocatedCString& type,
+    const std::int64_t value,
+    const Time date,
+    const String& payload) -> bool
+{
+    OT_ASSERT(nullptr != GetServerNym());
+
+    auto reason = api_.Factory().PasswordPrompt(__func__);
+
+    // If the change can not be journaled then fall back to a full snapshot.
+    if (!m_journal.Append(*m_pServerNym, reason, type, value, date, payload)) {
+        return SaveCron();
+    }
+
+    if (m_journal.SnapshotDue()) { return SaveCron(); }
+
+    return true;
+}
+
+auto OTCron::replay(const OTJournalEntry& entry) -> bool
+{
+    const auto type = UnallocatedCString{entry.Type().Get()};
+
+    if (("add" == type) || ("update" == type)) {
+        auto pItem{api_.Factory().InternalSession().CronItem(entry.Payload())};
+
+        if (false == bool(pItem)) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Unable to create cron item from journal entry.")
+                .Flush();
+
+            return false;
+        }
+
+        std::shared_ptr<OTCronItem> item{pItem.release()};
+
+        if (!item->VerifySignature(*m_pServerNym)) {
+            LogError()(OT_PRETTY_CLASS())(
+                "ERROR SECURITY: Server signature failed to verify on a cron "
+                "item while replaying journal: ")(item->GetTransactionNum())(
+                ".")
+                .Flush();
+
+            return false;
+        }
+
+        // An update replaces the previous state of the item
+        if (auto it = FindItemOnMap(item->GetTransactionNum());
+            m_mapCronItems.end() != it) {
+            erase_item(it);
+        }
+
+        return AddCronItem(item, false, entry.Date());
+    } else if ("remove" == type) {
+        // The removal hooks already ran before the entry was written
+        if (auto it = FindItemOnMap(entry.Value());
+            m_mapCronItems.end() != it) {
+            erase_item(it);
+        }
+
+        return true;
+    } else if ("numbers" == type) {
+        m_listTransactionNumbers.clear();
+        auto numbers = std::stringstream{entry.Payload().Get()};
+        auto lTransactionNumber = std::int64_t{};
+
+        while (numbers >> lTransactionNumber) {
+            AddTransactionNumber(lTransactionNumber);
+        }
+
         return true;
+    }
+
+    LogError()(OT_PRETTY_CLASS())("Unknown journal entry type: ")(type)(".")
+        .Flush();
+
+    return false;
 }
 
 // Loops through ALL markets, and calls pMarket->GetNym_OfferList(NYM_ID,
@@ -394,6 +521,10 @@ auto OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
 
         m_NOTARY_ID->SetString(strNotaryID);
 
+        const auto strJournal =
+            String::Factory(xml->getAttributeValue("journalSequence"));
+        m_lJournalStart = strJournal->Exists() ? strJournal->ToLong() : 0;
+
         LogConsole()(OT_PRETTY_CLASS())("Loading OTCron for NotaryID: ")(
             strNotaryID)(".")
             .Flush();
@@ -547,6 +678,7 @@ void OTCron::UpdateContents(const PasswordPrompt& reason)
 
     tag.add_attribute("version", m_strVersion->Get());
     tag.add_attribute("notaryID", NOTARY_ID->Get());
+    tag.add_attribute("journalSequence", std::to_string(m_journal.Next()));
 
     // Save the Market entries (the markets themselves are saved in a markets
     // folder.)
@@ -606,9 +738,16 @@ void OTCron::UpdateContents(const PasswordPrompt& reason)
 
 auto OTCron::computeTimeout() -> std::chrono::milliseconds
 {
-    return GetCronMsBetweenProcess() -
-           std::chrono::duration_cast<std::chrono::milliseconds>(
-               Clock::now() - last_executed_);
+    // NOTE a round never starts sooner than the configured interval after the
+    // previous one, and never before the earliest item is due.
+    static constexpr auto idle = std::chrono::hours{1};
+    const auto now = Clock::now();
+    const Time round = last_executed_ + GetCronMsBetweenProcess();
+    const Time due =
+        m_setSchedule.empty() ? now + idle : m_setSchedule.begin()->first;
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::max(round, due) - now);
 }
 
 // Make sure to call this regularly so the CronItems get a chance to process and
@@ -640,13 +779,28 @@ void OTCron::ProcessCronItems()
             .Flush();
         return;
     }
-    bool bNeedToSave = false;
+    bool bNumbersChanged = false;
+
+    // Only the items which are due are visited. Each one that stays on the
+    // list is rescheduled according to its own next due date, but never
+    // sooner than the next round.
+    const auto nextRound = Time{last_executed_ + GetCronMsBetweenProcess()};
+    const auto due = [&] {
+        auto out = UnallocatedVector<std::int64_t>{};
 
-    // loop through the cron items and tell each one to ProcessCron().
+        for (const auto& [time, number] : m_setSchedule) {
+            if (time > last_executed_) { break; }
+
+            out.emplace_back(number);
+        }
+
+        return out;
+    }();
+
+    // loop through the due cron items and tell each one to ProcessCron().
     // If the item returns true, that means leave it on the list. Otherwise,
     // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    for (const auto number : due) {
         if (GetTransactionCount() <= nTwentyPercent) {
             LogError()(OT_PRETTY_CLASS())(
                 "WARNING: Cron has fewer than 20 percent of its normal "
@@ -663,14 +817,17 @@ void OTCron::ProcessCronItems()
                 .Flush();
             break;
         }
-        auto pItem = it->second;
-        OT_ASSERT(false != bool(pItem));
+        auto pItem = GetItemByOfficialNum(number);
+
+        // The item may have been removed while processing an earlier one.
+        if (false == bool(pItem)) { continue; }
+
         LogVerbose()(OT_PRETTY_CLASS())("Processing item number: ")(
             pItem->GetTransactionNum())
             .Flush();
 
         if (pItem->ProcessCron(reason)) {
-            it++;
+            reschedule(number, std::max(pItem->GetNextDueDate(), nextRound));
             continue;
         }
         pItem->HookRemovalFromCron(
@@ -678,14 +835,12 @@ void OTCron::ProcessCronItems()
         LogConsole()(OT_PRETTY_CLASS())("Removing cron item: ")(
             pItem->GetTransactionNum())(".")
             .Flush();
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
-        m_mapCronItems.erase(it_map);
+        erase_item(FindItemOnMap(number));
+        save_change("remove", number, {}, String::Factory());
 
-        bNeedToSave = true;
+        bNumbersChanged = true;
     }
-    if (bNeedToSave) SaveCron();
+    if (bNumbersChanged) SaveTransactionNumbers();
 }
 
 // OTCron IS responsible for cleaning up theItem, and takes ownership.
@@ -733,18 +888,26 @@ auto OTCron::AddCronItem(
             return false;
         }
 
+        const auto number = theItem->GetTransactionNum();
+
         // Insert to the MAP (by Transaction Number)
         //
         m_mapCronItems.insert(
             std::pair<std::int64_t, std::shared_ptr<OTCronItem>>(
-                theItem->GetTransactionNum(), theItem));
+                number, theItem));
 
         // Insert to the MULTIMAP (by Date)
         //
-        m_multimapCronItems.insert(
+        auto it_multimap = m_multimapCronItems.insert(
             m_multimapCronItems.upper_bound(tDateAdded),
             std::pair<Time, std::shared_ptr<OTCronItem>>(tDateAdded, theItem));
 
+        // Insert to the SCHEDULE (by next due date)
+        //
+        auto it_schedule =
+            m_setSchedule.emplace(theItem->GetNextDueDate(), number).first;
+        m_mapCronIndex.try_emplace(number, it_multimap, it_schedule);
+
         theItem->SetCronPointer(*this);
         theItem->setServerNym(m_pServerNym);
         theItem->setNotaryID(m_NOTARY_ID);
@@ -782,7 +945,8 @@ auto OTCron::AddCronItem(
             //            theItem->SaveContract();
 
             // Since we added an item to the Cron, we SAVE it.
-            bSuccess = SaveCron();
+            bSuccess = save_change(
+                "add", number, tDateAdded, String::Factory(*theItem));
 
             if (bSuccess)
                 LogConsole()(OT_PRETTY_CLASS())(
@@ -831,20 +995,16 @@ auto OTCron::RemoveCronItem(
         auto pItem = it_map->second;
         //      OT_ASSERT(nullptr != pItem); // Already done in FindItemOnMap.
 
-        // We have to remove it from the multimap as well.
-        auto it_multimap = FindItemOnMultimap(lTransactionNum);
-        OT_ASSERT(m_multimapCronItems.end() != it_multimap);  // If found on
-                                                              // map, MUST be on
-                                                              // multimap also.
-
         pItem->HookRemovalFromCron(
             api_.Wallet(), theRemover, GetNextTransactionNumber(), reason);
 
-        m_mapCronItems.erase(it_map);            // Remove from MAP.
-        m_multimapCronItems.erase(it_multimap);  // Remove from MULTIMAP.
+        // Remove from the MAP, the MULTIMAP, and the SCHEDULE.
+        erase_item(it_map);
 
         // An item has been removed from Cron. SAVE.
-        return SaveCron();
+        return save_change(
+                   "remove", lTransactionNum, {}, String::Factory()) &&
+               SaveTransactionNumbers();
     }
 
     return false;
@@ -890,18 +1050,42 @@ auto OTCron::FindItemOnMap(std::int64_t lTransactionNum)
 auto OTCron::FindItemOnMultimap(std::int64_t lTransactionNum)
     -> multimapOfCronItems::iterator
 {
-    auto itt = m_multimapCronItems.begin();
+    auto itt = m_mapCronIndex.find(lTransactionNum);
 
-    while (m_multimapCronItems.end() != itt) {
-        auto pItem = itt->second;
-        OT_ASSERT(false != bool(pItem));
+    if (m_mapCronIndex.end() == itt) { return m_multimapCronItems.end(); }
 
-        if (pItem->GetTransactionNum() == lTransactionNum) break;
+    return itt->second.first;
+}
 
-        ++itt;
-    }
+auto OTCron::erase_item(mapOfCronItems::iterator it) -> void
+{
+    OT_ASSERT(m_mapCronItems.end() != it);
 
-    return itt;
+    auto index = m_mapCronIndex.find(it->first);
+
+    OT_ASSERT(m_mapCronIndex.end() != index);  // If found on map, MUST be
+                                               // indexed also.
+
+    const auto& [it_multimap, it_schedule] = index->second;
+    m_multimapCronItems.erase(it_multimap);
+    m_setSchedule.erase(it_schedule);
+    m_mapCronIndex.erase(index);
+    m_mapCronItems.erase(it);
+}
+
+auto OTCron::reschedule(const std::int64_t lTransactionNum, const Time due)
+    -> void
+{
+    auto index = m_mapCronIndex.find(lTransactionNum);
+
+    OT_ASSERT(m_mapCronIndex.end() != index);
+
+    auto& it_schedule = index->second.second;
+
+    if (it_schedule->first == due) { return; }
+
+    m_setSchedule.erase(it_schedule);
+    it_schedule = m_setSchedule.emplace(due, lTransactionNum).first;
 }
 
 // Look up a transaction by transaction number and see if it is in the map.
@@ -747,6 +747,15 @@ auto OTCronItem::ProcessCron(const PasswordPrompt& reason) -> bool
     return true;
 }
 
+// Items which have never been processed are due immediately. Otherwise an item
+// is not due again until its process interval has elapsed.
+auto OTCronItem::GetNextDueDate() const -> Time
+{
+    if (Time{} == GetLastProcessDate()) { return Time{}; }
+
+    return GetLastProcessDate() + GetProcessInterval();
+}
+
 // OTCron calls this when a cron item is added.
 // bForTheFirstTime=true means that this cron item is being
 // activated for the very first time. (Versus being re-added
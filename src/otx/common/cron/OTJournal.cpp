@@ -0,0 +1,229 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                            // IWYU pragma: associated
+#include "1_Internal.hpp"                          // IWYU pragma: associated
+#include "internal/otx/common/cron/OTJournal.hpp"  // IWYU pragma: associated
+
+#include <cstdint>
+#include <cstring>
+
+#include "internal/api/Legacy.hpp"
+#include "internal/otx/common/Contract.hpp"
+#include "internal/otx/common/StringXML.hpp"
+#include "internal/otx/common/XML.hpp"
+#include "internal/otx/common/util/Common.hpp"
+#include "internal/otx/common/util/Tag.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/api/session/Session.hpp"
+#include "opentxs/core/Armored.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
+#include "opentxs/util/Pimpl.hpp"
+#include "otx/common/OTStorage.hpp"
+
+namespace opentxs
+{
+OTJournalEntry::OTJournalEntry(const api::Session& api)
+    : Contract(api)
+    , sequence_(0)
+    , type_(String::Factory())
+    , value_(0)
+    , date_()
+    , payload_(String::Factory())
+{
+    m_strContractType = String::Factory("JOURNALENTRY");
+}
+
+OTJournalEntry::OTJournalEntry(
+    const api::Session& api,
+    const std::int64_t sequence,
+    const UnallocatedCString& type,
+    const std::int64_t value,
+    const Time date,
+    const String& payload)
+    : Contract(api)
+    , sequence_(sequence)
+    , type_(String::Factory(type))
+    , value_(value)
+    , date_(date)
+    , payload_(String::Factory(payload.Get()))
+{
+    m_strContractType = String::Factory("JOURNALENTRY");
+}
+
+// return -1 if error, 0 if nothing, and 1 if the node was processed.
+auto OTJournalEntry::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
+    -> std::int32_t
+{
+    if (!strcmp("journalEntry", xml->getNodeName())) {
+        m_strVersion = String::Factory(xml->getAttributeValue("version"));
+        type_ = String::Factory(xml->getAttributeValue("type"));
+        const auto sequence =
+            String::Factory(xml->getAttributeValue("sequence"));
+        const auto value = String::Factory(xml->getAttributeValue("value"));
+        const auto date = String::Factory(xml->getAttributeValue("date"));
+        sequence_ = sequence->Exists() ? sequence->ToLong() : 0;
+        value_ = value->Exists() ? value->ToLong() : 0;
+        date_ = date->Exists() ? parseTimestamp(date->Get()) : Time{};
+
+        return 1;
+    } else if (!strcmp("payload", xml->getNodeName())) {
+        if (!LoadEncodedTextField(xml, payload_)) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Error: Journal payload field without value.")
+                .Flush();
+
+            return -1;
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+void OTJournalEntry::UpdateContents(const PasswordPrompt& reason)
+{
+    // I release this because I'm about to repopulate it.
+    m_xmlUnsigned->Release();
+
+    Tag tag("journalEntry");
+
+    tag.add_attribute("version", m_strVersion->Get());
+    tag.add_attribute("sequence", std::to_string(sequence_));
+    tag.add_attribute("type", type_->Get());
+    tag.add_attribute("value", std::to_string(value_));
+    tag.add_attribute("date", formatTimestamp(date_));
+
+    if (payload_->Exists()) {
+        const auto ascPayload = Armored::Factory(payload_);
+        TagPtr tagPayload(new Tag("payload", ascPayload->Get()));
+        tag.add_tag(tagPayload);
+    }
+
+    UnallocatedCString str_result;
+    tag.output(str_result);
+
+    m_xmlUnsigned->Concatenate(String::Factory(str_result));
+}
+
+OTJournalEntry::~OTJournalEntry() = default;
+}  // namespace opentxs
+
+namespace opentxs
+{
+OTJournal::OTJournal(
+    const api::Session& api,
+    const char* folder,
+    const UnallocatedCString& base)
+    : api_(api)
+    , folder_(folder)
+    , base_(base)
+    , first_(0)
+    , next_(0)
+{
+}
+
+auto OTJournal::Append(
+    const identity::Nym& signer,
+    const PasswordPrompt& reason,
+    const UnallocatedCString& type,
+    const std::int64_t value,
+    const Time date,
+    const String& payload) -> bool
+{
+    auto entry = OTJournalEntry{api_, next_, type, value, date, payload};
+    const auto name = filename(next_);
+
+    if (!entry.SignContract(signer, reason) || !entry.SaveContract() ||
+        !entry.SaveContract(folder_.c_str(), name.c_str())) {
+        LogError()(OT_PRETTY_CLASS())("Error saving journal entry: ")(
+            folder_)(api::Legacy::PathSeparator())(name)(".")
+            .Flush();
+
+        return false;
+    }
+
+    ++next_;
+
+    return true;
+}
+
+auto OTJournal::Compact() -> void
+{
+    // NOTE the snapshot which includes these entries has already been saved,
+    // so failing to erase one of them is harmless: it will never be replayed.
+    for (auto sequence = first_; sequence < next_; ++sequence) {
+        OTDB::EraseValueByKey(
+            api_, api_.DataFolder(), folder_, filename(sequence), "", "");
+    }
+
+    first_ = next_;
+}
+
+auto OTJournal::filename(const std::int64_t sequence) const
+    -> UnallocatedCString
+{
+    return base_ + '.' + std::to_string(sequence) + ".jnl";
+}
+
+auto OTJournal::Replay(
+    const std::int64_t first,
+    const identity::Nym& verifier,
+    const Callback& cb) -> bool
+{
+    first_ = first;
+    next_ = first;
+
+    while (true) {
+        const auto name = filename(next_);
+
+        if (!OTDB::Exists(api_, api_.DataFolder(), folder_, name, "", "")) {
+            break;
+        }
+
+        auto entry = OTJournalEntry{api_};
+
+        if (!entry.Load(folder_.c_str(), name.c_str()) ||
+            !entry.VerifySignature(verifier)) {
+            LogError()(OT_PRETTY_CLASS())(
+                "ERROR SECURITY: Failed to load or verify journal entry: ")(
+                folder_)(api::Legacy::PathSeparator())(name)(".")
+                .Flush();
+
+            return false;
+        }
+
+        if (entry.Sequence() != next_) {
+            LogError()(OT_PRETTY_CLASS())("Journal entry ")(
+                name)(" has the wrong sequence number.")
+                .Flush();
+
+            return false;
+        }
+
+        if (!cb(entry)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to replay journal entry: ")(
+                name)(".")
+                .Flush();
+
+            return false;
+        }
+
+        ++next_;
+    }
+
+    if (next_ > first_) {
+        LogDetail()(OT_PRETTY_CLASS())("Replayed ")(next_ - first_)(
+            " journal entries for ")(base_)(".")
+            .Flush();
+    }
+
+    return true;
+}
+}  // namespace opentxs
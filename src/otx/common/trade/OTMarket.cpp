@@ -10,6 +10,8 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <exception>
+#include <initializer_list>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -18,6 +20,7 @@
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/api/session/Session.hpp"
 #include "internal/api/session/Wallet.hpp"
+#include "internal/core/Factory.hpp"
 #include "internal/otx/Types.hpp"
 #include "internal/otx/common/Account.hpp"
 #include "internal/otx/common/Contract.hpp"
@@ -28,6 +31,7 @@
 #include "internal/otx/common/XML.hpp"
 #include "internal/otx/common/cron/OTCron.hpp"
 #include "internal/otx/common/cron/OTCronItem.hpp"
+#include "internal/otx/common/cron/OTJournal.hpp"
 #include "internal/otx/common/trade/OTOffer.hpp"
 #include "internal/otx/common/trade/OTTrade.hpp"
 #include "internal/otx/common/util/Common.hpp"
@@ -59,6 +63,7 @@ OTMarket::OTMarket(const api::Session& api, const char* szFilename)
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_mapMarketAsks()
     , m_mapOffers()
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
@@ -80,6 +85,7 @@ OTMarket::OTMarket(const api::Session& api)
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_mapMarketAsks()
     , m_mapOffers()
     , m_NOTARY_ID(identifier::Notary::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
@@ -102,6 +108,7 @@ OTMarket::OTMarket(
     , m_pTradeList(nullptr)
     , m_mapBids()
     , m_mapAsks()
+    , m_mapMarketAsks()
     , m_mapOffers()
     , m_NOTARY_ID(NOTARY_ID)
     , m_INSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID)
@@ -147,6 +154,10 @@ auto OTMarket::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
         m_INSTRUMENT_DEFINITION_ID->SetString(strInstrumentDefinitionID);
         m_CURRENCY_TYPE_ID->SetString(strCurrencyTypeID);
 
+        const auto strJournal =
+            String::Factory(xml->getAttributeValue("journalSequence"));
+        m_lJournalStart = strJournal->Exists() ? strJournal->ToLong() : 0;
+
         LogConsole()(OT_PRETTY_CLASS())("Market. Scale: ")(m_lScale)(".")
             .Flush();
 
@@ -235,21 +246,26 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
         m_lLastSalePrice.Serialize(writer(buf));
         return buf;
     }());
-
-    // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
-                                                   // into string form.
-        auto ascOffer =
-            Armored::Factory(strOffer);  // Base64-encode that for storage.
-
-        TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
-        tagOffer->add_attribute(
-            "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
-        tag.add_tag(tagOffer);
+    tag.add_attribute("journalSequence", std::to_string(journal().Next()));
+
+    // Save the offers for sale. The market orders go first, as they are the
+    // first in line.
+    for (const auto* pAsks : {&m_mapMarketAsks, &m_mapAsks}) {
+        for (const auto& it : *pAsks) {
+            OTOffer* pOffer = it.second;
+            OT_ASSERT(nullptr != pOffer);
+
+            auto strOffer = String::Factory(*pOffer);  // Extract the offer
+                                                       // contract into string
+                                                       // form.
+            auto ascOffer =
+                Armored::Factory(strOffer);  // Base64-encode that for storage.
+
+            TagPtr tagOffer(new Tag("offer", ascOffer->Get()));
+            tagOffer->add_attribute(
+                "dateAdded", formatTimestamp(pOffer->GetDateAddedToMarket()));
+            tag.add_tag(tagOffer);
+        }
     }
 
     // Save the bids.
@@ -278,11 +294,13 @@ auto OTMarket::GetTotalAvailableAssets() -> Amount
 {
     Amount lTotal = 0;
 
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
+    for (const auto* pAsks : {&m_mapMarketAsks, &m_mapAsks}) {
+        for (const auto& it : *pAsks) {
+            OTOffer* pOffer = it.second;
+            OT_ASSERT(nullptr != pOffer);
 
-        lTotal += pOffer->GetAmountAvailable();
+            lTotal += pOffer->GetAmountAvailable();
+        }
     }
 
     return lTotal;
@@ -302,7 +320,7 @@ auto OTMarket::GetNym_OfferList(
     // as a data member to an offer list, then pack it into ascOutput.
     //
     for (auto& it : m_mapOffers) {
-        OTOffer* pOffer = it.second;
+        OTOffer* pOffer = it.second->second;
         OT_ASSERT(nullptr != pOffer);
 
         OTTrade* pTrade = pOffer->GetTrade();
@@ -556,46 +574,52 @@ auto OTMarket::GetOfferList(
 
     nTempDepth = 0;
 
-    for (auto& it : m_mapAsks) {
-        if (nTempDepth++ > lDepth) break;
-
-        OTOffer* pOffer = it.second;
-        OT_ASSERT(nullptr != pOffer);
-
-        // OfferDataMarket"
-        std::unique_ptr<OTDB::AskData> pOfferData(dynamic_cast<OTDB::AskData*>(
-            OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
-
-        const std::int64_t& lTransactionNum = pOffer->GetTransactionNum();
-        const Amount& lPriceLimit = pOffer->GetPriceLimit();
-        const Amount lAvailableAssets = pOffer->GetAmountAvailable();
-        const Amount& lMinimumIncrement = pOffer->GetMinimumIncrement();
-        const auto tDateAddedToMarket = pOffer->GetDateAddedToMarket();
-
-        pOfferData->transaction_id = std::to_string(lTransactionNum);
-        pOfferData->price_per_scale = [&] {
-            auto buf = UnallocatedCString{};
-            lPriceLimit.Serialize(writer(buf));
-            return buf;
-        }();
-        pOfferData->available_assets = [&] {
-            auto buf = UnallocatedCString{};
-            lAvailableAssets.Serialize(writer(buf));
-            return buf;
-        }();
-        pOfferData->minimum_increment = [&] {
-            auto buf = UnallocatedCString{};
-            lMinimumIncrement.Serialize(writer(buf));
-            return buf;
-        }();
-        pOfferData->date = std::to_string(Clock::to_time_t(tDateAddedToMarket));
-
-        // *pOfferData is CLONED at this time (I'm still responsible to delete.)
-        // That's also why I add it here, below: So the data is set right before
-        // the cloning occurs.
-        //
-        pOfferList->AddAskData(*pOfferData);
-        nOfferCount++;
+    // The market orders are first in line, so they are listed first.
+    for (const auto* pAsks : {&m_mapMarketAsks, &m_mapAsks}) {
+        for (const auto& it : *pAsks) {
+            if (nTempDepth++ > lDepth) break;
+
+            OTOffer* pOffer = it.second;
+            OT_ASSERT(nullptr != pOffer);
+
+            // OfferDataMarket"
+            std::unique_ptr<OTDB::AskData> pOfferData(
+                dynamic_cast<OTDB::AskData*>(
+                    OTDB::CreateObject(OTDB::STORED_OBJ_ASK_DATA)));
+
+            const std::int64_t& lTransactionNum =
+                pOffer->GetTransactionNum();
+            const Amount& lPriceLimit = pOffer->GetPriceLimit();
+            const Amount lAvailableAssets = pOffer->GetAmountAvailable();
+            const Amount& lMinimumIncrement = pOffer->GetMinimumIncrement();
+            const auto tDateAddedToMarket = pOffer->GetDateAddedToMarket();
+
+            pOfferData->transaction_id = std::to_string(lTransactionNum);
+            pOfferData->price_per_scale = [&] {
+                auto buf = UnallocatedCString{};
+                lPriceLimit.Serialize(writer(buf));
+                return buf;
+            }();
+            pOfferData->available_assets = [&] {
+                auto buf = UnallocatedCString{};
+                lAvailableAssets.Serialize(writer(buf));
+                return buf;
+            }();
+            pOfferData->minimum_increment = [&] {
+                auto buf = UnallocatedCString{};
+                lMinimumIncrement.Serialize(writer(buf));
+                return buf;
+            }();
+            pOfferData->date =
+                std::to_string(Clock::to_time_t(tDateAddedToMarket));
+
+            // *pOfferData is CLONED at this time (I'm still responsible to
+            // delete.) That's also why I add it here, below: So the data is
+            // set right before the cloning occurs.
+            //
+            pOfferList->AddAskData(*pOfferData);
+            nOfferCount++;
+        }
     }
 
     // Now pack the list into strOutput...
@@ -665,7 +689,7 @@ auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
     }
     // Found it!
     else {
-        OTOffer* pOffer = it->second;
+        OTOffer* pOffer = it->second->second;
 
         OT_ASSERT((nullptr != pOffer));
 
@@ -686,6 +710,17 @@ auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
 auto OTMarket::RemoveOffer(
     const std::int64_t& lTransactionNum,
     const PasswordPrompt& reason) -> bool
+{
+    if (remove_offer(lTransactionNum)) {
+        // <====== SAVE since an offer was removed.
+        return save_change(
+            "remove", lTransactionNum, {}, String::Factory(), reason);
+    } else {
+        return false;
+    }
+}
+
+auto OTMarket::remove_offer(const std::int64_t& lTransactionNum) -> bool
 {
     bool bReturnValue = false;
 
@@ -702,73 +737,28 @@ auto OTMarket::RemoveOffer(
     }
     // Otherwise, if it WAS already there, remove it properly.
     else {
-        OTOffer* pOffer = it->second;
+        const auto position = it->second;
+        OTOffer* pOffer = position->second;
 
         OT_ASSERT(nullptr != pOffer);
 
-        // This removes it from one list (the one indexed by transaction
-        // number.)
-        // But it's still on one of the other lists...
-        m_mapOffers.erase(it);
-
         // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
-
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
-
-        for (auto iii = pMap->begin(); iii != pMap->end(); ++iii) {
-            pSameOffer = iii->second;
-
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
-
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
-
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
+        mapOfOffers* pMap =
+            (pOffer->IsBid()
+                 ? &m_mapBids
+                 : (pOffer->IsMarketOrder() ? &m_mapMarketAsks : &m_mapAsks));
 
-        if (nullptr == pSameOffer) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Removed offer from offers list, but not found on bid/ask "
-                "list.")
-                .Flush();
-        } else  // This means it was found and removed from the second list as
-                // well.
-        {
-            bReturnValue = true;  // Success.
-        }
-
-        // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
-        // They SHOULD be pointers to the SAME object.
-        // Therefore I CANNOT delete them both.
-        //
-        OT_ASSERT(pOffer == pSameOffer);
+        // Each offer remembers its position on the bid or ask list when it is
+        // first inserted, so there's no need to search for it.
+        m_mapOffers.erase(it);
+        pMap->erase(position);
 
         delete pOffer;
         pOffer = nullptr;
-        pSameOffer = nullptr;
+        bReturnValue = true;  // Success.
     }
 
-    if (bReturnValue)
-        return SaveMarket(reason);  // <====== SAVE since an offer was removed.
-    else
-        return false;
+    return bReturnValue;
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -805,15 +795,8 @@ auto OTMarket::AddOffer(
         //
         auto it = m_mapOffers.find(lTransactionNum);
 
-        // If it's not already on the list, then add it...
-        if (it == m_mapOffers.end()) {
-            m_mapOffers[lTransactionNum] = &theOffer;
-            LogTrace()(OT_PRETTY_CLASS())(
-                "Offer added as an offer to the market.")
-                .Flush();
-        }
-        // Otherwise, if it was already there, log an error.
-        else {
+        // If it's already there, log an error.
+        if (it != m_mapOffers.end()) {
             LogError()(OT_PRETTY_CLASS())(
                 "Attempt to add Offer to Market with pre-existing "
                 "transaction number: ")(lTransactionNum)(".")
@@ -821,31 +804,47 @@ auto OTMarket::AddOffer(
             return false;
         }
 
-        // Okay so we successfully added it to one list (indexed by Transaction
-        // Num) and we
-        // know it validated as an offer, AND we know it wasn't already on the
-        // market.
+        // Okay so we know it validated as an offer, AND we know it wasn't
+        // already on the market.
         //
-        // So next, let's add it to the lists that are indexed by price:
+        // So next, let's add it to the lists that are indexed by price, and
+        // remember where it went in the list indexed by Transaction Num:
 
         // Determine if it's a buy or sell, and add it to the right list.
         if (theOffer.IsBid()) {
             // No bother checking if the offer is already on this list,
             // since the code above basically already verifies that for us.
 
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
+            m_mapOffers.emplace(
+                lTransactionNum,
+                m_mapBids.insert(
+                    m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
+                                                         // first, so I am last
+                                                         // in line at lower
+                                                         // bound.
+                    std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer)));
             LogTrace()(OT_PRETTY_CLASS())("Offer added as a bid to the market.")
                 .Flush();
+        } else if (theOffer.IsMarketOrder()) {
+            // Market orders are kept apart from the priced asks, in the
+            // order they were added.
+            m_mapOffers.emplace(
+                lTransactionNum,
+                m_mapMarketAsks.insert(
+                    m_mapMarketAsks.end(),
+                    std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer)));
+            LogTrace()(OT_PRETTY_CLASS())(
+                "Offer added as a market order ask to the market.")
+                .Flush();
         } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer));
+            m_mapOffers.emplace(
+                lTransactionNum,
+                m_mapAsks.insert(
+                    m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
+                                                         // first, so I am last
+                                                         // in line at upper
+                                                         // bound.
+                    std::pair<Amount, OTOffer*>(lPriceLimit, &theOffer)));
             LogTrace()(OT_PRETTY_CLASS())(
                 "Offer added as an ask to the market.")
                 .Flush();
@@ -857,8 +856,9 @@ auto OTMarket::AddOffer(
             //
             theOffer.SetDateAddedToMarket(Clock::now());
 
-            return SaveMarket(reason);  // <====== SAVE since an offer
-                                        // was added to the Market.
+            return SaveOffer(theOffer, reason);  // <====== SAVE since an
+                                                 // offer was added to the
+                                                 // Market.
         } else {
             // Set this to the date passed in, since this offer was
             // added to the market in the past, and we are preserving that date.
@@ -889,6 +889,14 @@ auto OTMarket::LoadMarket() -> bool
 
     if (bSuccess) bSuccess = VerifySignature(*(GetCron()->GetServerNym()));
 
+    // Apply the changes which were journaled after the snapshot was saved.
+    if (bSuccess) {
+        bSuccess = journal().Replay(
+            m_lJournalStart,
+            *(GetCron()->GetServerNym()),
+            [this](const auto& entry) { return replay(entry); });
+    }
+
     // Load the list of recent market trades (informational only.)
     //
     if (bSuccess) {
@@ -939,28 +947,145 @@ auto OTMarket::SaveMarket(const PasswordPrompt& reason) -> bool
         return false;
     }
 
-    // Save a copy of recent trades.
+    // Every journal entry written so far is included in this snapshot.
+    journal().Compact();
+    save_recent_trades();
 
-    if (nullptr != m_pTradeList) {
+    return true;
+}
+
+auto OTMarket::SaveOffer(const OTOffer& theOffer, const PasswordPrompt& reason)
+    -> bool
+{
+    return save_change(
+        "offer",
+        theOffer.GetTransactionNum(),
+        theOffer.GetDateAddedToMarket(),
+        String::Factory(theOffer),
+        reason);
+}
 
-        auto filename = api::Legacy::GetFilenameBin(str_MARKET_ID->Get());
+auto OTMarket::journal() -> OTJournal&
+{
+    // The market ID is not known until the instrument definition, currency,
+    // and scale have been set.
+    if (false == bool(m_pJournal)) {
+        m_pJournal = std::make_unique<OTJournal>(
+            api_,
+            api_.Internal().Legacy().Market(),
+            String::Factory(Identifier::Factory(*this))->Get());
+    }
 
-        const char* szSubFolder = "recent";  // todo stop hardcoding.
+    return *m_pJournal;
+}
+
+auto OTMarket::replay(const OTJournalEntry& entry) -> bool
+{
+    const auto type = UnallocatedCString{entry.Type().Get()};
+
+    if ("offer" == type) {
+        auto pOffer{api_.Factory().InternalSession().Offer(
+            m_NOTARY_ID, m_INSTRUMENT_DEFINITION_ID, m_CURRENCY_TYPE_ID, m_lScale)};
+
+        OT_ASSERT(false != bool(pOffer));
+
+        // NOTE the journal entry itself is signed by the server nym
+        if (!pOffer->LoadContractFromString(entry.Payload())) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Failed to load offer from journal entry.")
+                .Flush();
+
+            return false;
+        }
+
+        // A journaled offer replaces any previous state of the same offer
+        remove_offer(pOffer->GetTransactionNum());
+        auto reason = api_.Factory().PasswordPrompt(__func__);
 
-        // If this fails, oh well. It's informational, anyway.
-        if (!OTDB::StoreObject(
-                api_,
-                *m_pTradeList,
-                api_.DataFolder(),
-                szFoldername,  // markets
-                szSubFolder,   // markets/recent
-                filename,
-                ""))  // markets/recent/<Market_ID>.bin
+        if (!AddOffer(nullptr, *pOffer, reason, false, entry.Date())) {
             LogError()(OT_PRETTY_CLASS())(
-                "Error saving recent trades for Market: ")(
-                szFoldername)(api::Legacy::PathSeparator())(
-                szSubFolder)(api::Legacy::PathSeparator())(szFilename)(".")
+                "Failed to add offer from journal entry.")
                 .Flush();
+
+            return false;
+        }
+
+        pOffer.release();
+
+        return true;
+    } else if ("remove" == type) {
+        remove_offer(entry.Value());
+
+        return true;
+    } else if ("sale" == type) {
+        try {
+            m_lLastSalePrice = factory::Amount(entry.Payload().Get());
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
+
+        m_strLastSaleDate = std::to_string(entry.Value());
+
+        return true;
+    }
+
+    LogError()(OT_PRETTY_CLASS())("Unknown journal entry type: ")(type)(".")
+        .Flush();
+
+    return false;
+}
+
+auto OTMarket::save_change(
+    const UnallocatedCString& type,
+    const std::int64_t value,
+    const Time date,
+    const String& payload,
+    const PasswordPrompt& reason) -> bool
+{
+    OT_ASSERT(nullptr != GetCron());
+    OT_ASSERT(nullptr != GetCron()->GetServerNym());
+
+    auto& log = journal();
+
+    // If the change can not be journaled then fall back to a full snapshot.
+    if (!log.Append(
+            *(GetCron()->GetServerNym()), reason, type, value, date, payload)) {
+        return SaveMarket(reason);
+    }
+
+    if (log.SnapshotDue()) { return SaveMarket(reason); }
+
+    return true;
+}
+
+auto OTMarket::save_recent_trades() -> bool
+{
+    if (nullptr == m_pTradeList) { return true; }
+
+    auto MARKET_ID = Identifier::Factory(*this);
+    auto str_MARKET_ID = String::Factory(MARKET_ID);
+    const char* szFoldername = api_.Internal().Legacy().Market();
+    auto filename = api::Legacy::GetFilenameBin(str_MARKET_ID->Get());
+    const char* szSubFolder = "recent";  // todo stop hardcoding.
+
+    // If this fails, oh well. It's informational, anyway.
+    if (!OTDB::StoreObject(
+            api_,
+            *m_pTradeList,
+            api_.DataFolder(),
+            szFoldername,  // markets
+            szSubFolder,   // markets/recent
+            filename,
+            "")) {  // markets/recent/<Market_ID>.bin
+        LogError()(OT_PRETTY_CLASS())(
+            "Error saving recent trades for Market: ")(
+            szFoldername)(api::Legacy::PathSeparator())(
+            szSubFolder)(api::Legacy::PathSeparator())(filename)(".")
+            .Flush();
+
+        return false;
     }
 
     return true;
@@ -1015,27 +1140,12 @@ auto OTMarket::GetLowestAskPrice() -> Amount
 {
     Amount lPrice = 0;
 
+    // Market orders have a 0 price, which would undercut the actual prices,
+    // but they are kept on their own list so the first ask here is the
+    // lowest priced one.
     auto it = m_mapAsks.begin();
 
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
-
-            if (it == m_mapAsks.end()) break;
-
-            lPrice = it->first;
-        }
-    }
+    if (it != m_mapAsks.end()) { lPrice = it->first; }
 
     return lPrice;
 }
@@ -2002,12 +2112,25 @@ void OTMarket::ProcessTrade(
                 // that we just processed. Make sure to save the Market
                 // since it contains those offers that have just
                 // updated.
-                SaveMarket(reason);
-
-                // The Trade has changed, and it is stored as a
-                // CronItem. So I save Cron as well, for the same reason
-                // I saved the Market.
-                pCron->SaveCron();
+                SaveOffer(theOffer, reason);
+                SaveOffer(theOtherOffer, reason);
+                save_change(
+                    "sale",
+                    String::StringToLong(m_strLastSaleDate),
+                    {},
+                    String::Factory([&] {
+                        auto buf = UnallocatedCString{};
+                        m_lLastSalePrice.Serialize(writer(buf));
+                        return buf;
+                    }()),
+                    reason);
+                save_recent_trades();
+
+                // The Trades have changed, and they are stored as
+                // CronItems. So I save them as well, for the same reason
+                // I saved the offers.
+                pCron->SaveCronItem(theTrade);
+                pCron->SaveCronItem(*pOtherTrade);
             }
 
             //
@@ -2607,19 +2730,14 @@ auto OTMarket::ProcessTrade(
             // NOTE: Market orders only process once, and they are
             // processed in the order they were added to the market.
             //
-            // If BOTH offers are market orders, we just skip this ask.
-            //
-            // But FURTHERMORE: We ONLY process a market order as
-            // theOffer, not as pAsk! Imagine if pAsk is a market order
-            // and theOffer isn't -- that would mean pAsk hasn't been
-            // processed yet (since it will only process once.) So it
-            // needs to wait its turn! It will get its one shot WHEN ITS
-            // TURN comes.
+            // We ONLY process a market order as theOffer, not as pAsk!
+            // Imagine if pAsk is a market order and theOffer isn't --
+            // that would mean pAsk hasn't been processed yet (since it
+            // will only process once.) So it needs to wait its turn! It
+            // will get its one shot WHEN ITS TURN comes. That's why the
+            // market order asks are on m_mapMarketAsks, not here.
             //
-            if (pAsk->IsMarketOrder())
-                //          if (theOffer.IsMarketOrder() &&
-                // pAsk->IsMarketOrder())
-                continue;
+            OT_ASSERT(false == pAsk->IsMarketOrder());
 
             // I'm buying.
             // If the ask price is less than, or equal to, my price
@@ -2849,6 +2967,8 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
+    m_mapOffers.clear();
+
     while (!m_mapBids.empty()) {
         OTOffer* pOffer = m_mapBids.begin()->second;
         m_mapBids.erase(m_mapBids.begin());
@@ -2861,6 +2981,12 @@ void OTMarket::Release_Market()
         delete pOffer;
         pOffer = nullptr;
     }
+    while (!m_mapMarketAsks.empty()) {
+        OTOffer* pOffer = m_mapMarketAsks.begin()->second;
+        m_mapMarketAsks.erase(m_mapMarketAsks.begin());
+        delete pOffer;
+        pOffer = nullptr;
+    }
 }
 
 void OTMarket::Release()
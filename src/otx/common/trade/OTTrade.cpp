@@ -570,7 +570,7 @@ auto OTTrade::GetOffer(
             offer_->SignContract(*(GetCron()->GetServerNym()), reason);
             offer_->SaveContract();
 
-            pMarket->SaveMarket(reason);
+            pMarket->SaveOffer(*offer_, reason);
 
             // Now when the market loads next time, it can verify this offer
             // using the server's signature,
@@ -639,7 +639,7 @@ auto OTTrade::GetOffer(
                 offer_->SignContract(*(GetCron()->GetServerNym()), reason);
                 offer_->SaveContract();
 
-                pMarket->SaveMarket(reason);
+                pMarket->SaveOffer(*offer_, reason);
 
                 // Now when the market loads next time, it can verify this offer
                 // using the server's signature,
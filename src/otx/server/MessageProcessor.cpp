@@ -7,8 +7,10 @@
 #include "1_Internal.hpp"                   // IWYU pragma: associated
 #include "otx/server/MessageProcessor.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -18,6 +20,7 @@
 
 #include "Proto.hpp"
 #include "Proto.tpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/api/session/Notary.hpp"
@@ -28,11 +31,13 @@
 #include "internal/network/zeromq/message/Message.hpp"  // IWYU pragma: keep
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/otx/common/Message.hpp"
+#include "internal/otx/Types.hpp"
 #include "internal/otx/server/Types.hpp"
 #include "internal/serialization/protobuf/Check.hpp"
 #include "internal/serialization/protobuf/verify/ServerRequest.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Factory.hpp"
@@ -62,6 +67,7 @@
 #include "serialization/protobuf/OTXPush.pb.h"
 #include "serialization/protobuf/ServerReply.pb.h"
 #include "serialization/protobuf/ServerRequest.pb.h"
+#include "util/ScopeGuard.hpp"
 
 namespace opentxs::server
 {
@@ -117,6 +123,11 @@ MessageProcessor::Imp::Imp(
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
+    , lanes_()
+    , cron_lock_()
+    , cron_cv_()
+    , cron_wake_(false)
+    , gate_()
 {
     zmq_batch_.listen_callbacks_.emplace_back(zmq::ListenCallback::Factory(
         [this](auto&& m) { old_pipeline(std::move(m)); }));
@@ -192,6 +203,8 @@ auto MessageProcessor::Imp::associate_connection(
 auto MessageProcessor::Imp::cleanup() noexcept -> void
 {
     running_ = false;
+    wake_cron();
+    gate_.shutdown();
     zmq_handle_.Release();
 }
 
@@ -267,6 +280,44 @@ auto MessageProcessor::Imp::init(
     OT_ASSERT(queued);
 }
 
+auto MessageProcessor::Imp::is_nym_local(const Message& request) noexcept
+    -> bool
+{
+    // NOTE these commands only read or modify the context, nymbox, and
+    // accounts of the nym which sent the request. Everything else may touch
+    // the accounts of other nyms, cron, markets, or notary-wide contracts.
+    switch (Message::Type(request.m_strCommand->Get())) {
+        case MessageType::pingNotary:
+        case MessageType::getRequestNumber:
+        case MessageType::getTransactionNumbers:
+        case MessageType::checkNym:
+        case MessageType::getNymbox:
+        case MessageType::getBoxReceipt:
+        case MessageType::getAccountData:
+        case MessageType::processNymbox:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMint: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
+auto MessageProcessor::Imp::lane(const Message& request) const noexcept
+    -> std::mutex&
+{
+    static const auto hasher = std::hash<std::string_view>{};
+    const auto nym = std::string_view{
+        request.m_strNymID->Get(), request.m_strNymID->GetLength()};
+
+    return lanes_[hasher(nym) % lanes_.size()];
+}
+
 auto MessageProcessor::Imp::old_pipeline(zmq::Message&& message) noexcept
     -> void
 {
@@ -294,8 +345,6 @@ auto MessageProcessor::Imp::process_backend(
 {
     auto reply = UnallocatedCString{};
     const auto error = [&] {
-        // ProcessCron and process_backend must not run simultaneously
-        auto lock = Lock{lock_};
         const auto request = [&] {
             auto out = UnallocatedCString{};
             const auto body = incoming.Body();
@@ -447,7 +496,32 @@ auto MessageProcessor::Imp::process_legacy(
 {
     LogTrace()(OT_PRETTY_CLASS())("Processing request via ")(id.asHex())
         .Flush();
-    process_internal(process_backend(tagged, std::move(incoming)));
+    // NOTE requests are executed on the general thread pool so the zmq thread
+    // is free to accept the next request. The reply is handed back to the zmq
+    // thread since it owns the frontend socket.
+    auto ticket = std::make_shared<Ticket>(gate_.get());
+
+    if (*ticket) { return; }
+
+    const auto queued = api_.Network().Asio().Internal().Post(
+        ThreadPool::General,
+        [this, tagged, ticket, message = std::move(incoming)]() mutable {
+            auto reply = process_backend(tagged, std::move(message));
+            const auto sent = zmq_thread_->Modify(
+                frontend_id_,
+                [this, out = std::move(reply)](auto&) mutable {
+                    process_internal(std::move(out));
+                });
+
+            if (false == sent.first) {
+                LogError()(OT_PRETTY_CLASS())("Failed to queue reply message.")
+                    .Flush();
+            }
+        });
+
+    if (false == queued) {
+        LogError()(OT_PRETTY_CLASS())("Failed to queue request.").Flush();
+    }
 }
 
 auto MessageProcessor::Imp::process_message(
@@ -484,8 +558,7 @@ auto MessageProcessor::Imp::process_message(
 
     OT_ASSERT(false != bool(replymsg));
 
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+    const bool processed = process_user_command(*request, *replymsg);
 
     if (false == processed) {
         LogDetail()(OT_PRETTY_CLASS())("Failed to process user command ")(
@@ -631,6 +704,26 @@ auto MessageProcessor::Imp::process_proto(
     }
 }
 
+auto MessageProcessor::Imp::process_user_command(
+    const Message& request,
+    Message& reply) noexcept -> bool
+{
+    if (is_nym_local(request)) {
+        // NOTE requests from different nyms run in parallel with each other
+        // but never in parallel with cron or with notary-wide requests
+        auto gate = sLock{shared_lock_};
+        auto lock = Lock{lane(request)};
+
+        return server_.CommandProcessor().ProcessUserCommand(request, reply);
+    } else {
+        // NOTE these requests may have added or removed cron items
+        auto post = ScopeGuard{[this] { wake_cron(); }};
+        auto gate = eLock{shared_lock_};
+
+        return server_.CommandProcessor().ProcessUserCommand(request, reply);
+    }
+}
+
 auto MessageProcessor::Imp::query_connection(const identifier::Nym& id) noexcept
     -> const ConnectionData&
 {
@@ -649,17 +742,40 @@ auto MessageProcessor::Imp::query_connection(const identifier::Nym& id) noexcept
 auto MessageProcessor::Imp::run() noexcept -> void
 {
     while (running_.load()) {
-        // timeout is the time left until the next cron should execute.
-        const auto timeout = server_.ComputeTimeout();
+        // timeout is the time left until the next cron item is due.
+        const auto timeout = [&] {
+            auto gate = sLock{shared_lock_};
+
+            return server_.ComputeTimeout();
+        }();
 
         if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            auto lock = Lock{lock_};
+            // ProcessCron must not run simultaneously with any request
+            auto lock = eLock{shared_lock_};
             server_.ProcessCron();
         }
 
-        Sleep(50ms);
+        const auto wait = [&] {
+            auto gate = sLock{shared_lock_};
+
+            return std::clamp(
+                server_.ComputeTimeout(), cron_min_wait_, cron_max_wait_);
+        }();
+        auto lock = Lock{cron_lock_};
+        cron_cv_.wait_for(
+            lock, wait, [this] { return cron_wake_ || (!running_.load()); });
+        cron_wake_ = false;
+    }
+}
+
+auto MessageProcessor::Imp::wake_cron() noexcept -> void
+{
+    {
+        auto lock = Lock{cron_lock_};
+        cron_wake_ = true;
     }
+
+    cron_cv_.notify_one();
 }
 
 auto MessageProcessor::Imp::Start() noexcept -> void
@@ -5,7 +5,10 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -33,6 +36,7 @@
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/util/Container.hpp"
 #include "serialization/protobuf/ServerRequest.pb.h"
+#include "util/Gatekeeper.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -77,6 +81,7 @@ class Server;
 }  // namespace server
 
 class OTPassword;
+class Message;
 class PasswordPrompt;
 class Secret;
 // }  // namespace v1
@@ -113,7 +118,17 @@ private:
     // connection identifier, old format
     using ConnectionData = std::pair<OTData, bool>;
 
+    // Requests which only touch the state of the requesting nym are executed
+    // concurrently, serialized per nym by hashing the nym id onto one of these
+    // lanes.
+    using Lanes = std::array<std::mutex, 64>;
+
     static constexpr auto zap_domain_{"opentxs-otx"};
+    // Bounds on how long the cron thread sleeps between checks. The lower bound
+    // prevents spinning while cron is unable to make progress (for example
+    // before it has been activated).
+    static constexpr auto cron_min_wait_ = std::chrono::milliseconds{50};
+    static constexpr auto cron_max_wait_ = std::chrono::milliseconds{60000};
 
     const api::session::Notary& api_;
     Server& server_;
@@ -131,12 +146,19 @@ private:
     mutable int drop_outgoing_;
     UnallocatedMap<OTNymID, ConnectionData> active_connections_;
     mutable std::shared_mutex connection_map_lock_;
+    mutable Lanes lanes_;
+    mutable std::mutex cron_lock_;
+    std::condition_variable cron_cv_;
+    bool cron_wake_;
+    Gatekeeper gate_;
 
     static auto get_connection(
         const network::zeromq::Message& incoming) noexcept -> OTData;
+    static auto is_nym_local(const Message& request) noexcept -> bool;
 
     auto extract_proto(const network::zeromq::Frame& incoming) const noexcept
         -> proto::ServerRequest;
+    auto lane(const Message& request) const noexcept -> std::mutex&;
 
     auto associate_connection(
         const bool oldFormat,
@@ -159,6 +181,8 @@ private:
     auto process_message(
         const UnallocatedCString& messageString,
         UnallocatedCString& reply) noexcept -> bool;
+    auto process_user_command(const Message& request, Message& reply) noexcept
+        -> bool;
     auto process_notification(network::zeromq::Message&& incoming) noexcept
         -> void;
     auto process_proto(
@@ -168,5 +192,6 @@ private:
     auto query_connection(const identifier::Nym& nymID) noexcept
         -> const ConnectionData&;
     auto run() noexcept -> void;
+    auto wake_cron() noexcept -> void;
 };
 }  // namespace opentxs::server
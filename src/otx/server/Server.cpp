@@ -142,7 +142,7 @@ void Server::ProcessCron()
             break;
     }
 
-    if (bAddedNumbers) { m_Cron->SaveCron(); }
+    if (bAddedNumbers) { m_Cron->SaveTransactionNumbers(); }
 
     m_Cron->ProcessCronItems();  // This needs to be called regularly for
                                  // trades, markets, payment plans, etc to
@@ -8,11 +8,13 @@
 #include "otx/server/Transactor.hpp"  // IWYU pragma: associated
 
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "internal/otx/AccountList.hpp"
 #include "internal/otx/common/Account.hpp"
 #include "internal/util/Exclusive.hpp"
+#include "internal/util/Lockable.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/session/Notary.hpp"
 #include "opentxs/core/String.hpp"
@@ -31,6 +33,7 @@ namespace opentxs::server
 Transactor::Transactor(Server& server, const PasswordPrompt& reason)
     : server_(server)
     , reason_(reason)
+    , lock_()
     , transactionNumber_(0)
     , idToBasketMap_()
     , contractIdToBasketAccountId_()
@@ -49,6 +52,17 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 auto Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber) -> bool
 {
+    const auto lock = Lock{lock_};
+
+    return issue_next_transaction_number(lock, lTransactionNumber);
+}
+
+auto Transactor::issue_next_transaction_number(
+    const Lock& lock,
+    TransactionNumber& lTransactionNumber) -> bool
+{
+    OT_ASSERT(CheckLock(lock, lock_));
+
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
     // twice.
@@ -72,7 +86,11 @@ auto Transactor::issueNextTransactionNumberToNym(
     otx::context::Client& context,
     TransactionNumber& lTransactionNumber) -> bool
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    const auto lock = Lock{lock_};
+
+    if (!issue_next_transaction_number(lock, lTransactionNumber)) {
+        return false;
+    }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
@@ -7,10 +7,12 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "internal/api/session/Wallet.hpp"
 #include "internal/otx/AccountList.hpp"
 #include "internal/otx/common/Account.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
 
@@ -102,6 +104,8 @@ private:
 
     Server& server_;
     const PasswordPrompt& reason_;
+    // Transaction numbers may be issued by concurrently executing requests
+    mutable std::mutex lock_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transactionNumber_;
     // maps basketId with basketAccountId
@@ -113,6 +117,10 @@ private:
     // The list of voucher accounts (see GetVoucherAccount below for details)
     otx::internal::AccountList voucherAccounts_;
 
+    auto issue_next_transaction_number(
+        const Lock& lock,
+        TransactionNumber& txNumber) -> bool;
+
     Transactor() = delete;
 };
 }  // namespace opentxs::server
@@ -8,8 +8,11 @@
 #pragma once
 
 #include <boost/system/error_code.hpp>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <functional>
 #include <future>
@@ -17,7 +20,9 @@
 #include <mutex>
 #include <queue>
 #include <random>
+#include <string>
 #include <string_view>
+#include <utility>
 
 #include "internal/api/network/Asio.hpp"
 #include "internal/network/zeromq/Context.hpp"
@@ -43,6 +48,7 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/Histogram.hpp"
 #include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
 
@@ -63,6 +69,34 @@ class Log;
 
 namespace opentxs
 {
+/// Determines which queued messages of the same type an Actor may merge
+enum class CoalesceMode : std::uint8_t {
+    /// Only the most recent message for each key is processed
+    latest,
+    /// Identical messages are processed once
+    unique,
+};
+
+struct CoalesceRule {
+    CoalesceMode mode_{CoalesceMode::latest};
+    /// Number of body frames following the work tag which identify the
+    /// subject of a message. Ignored by CoalesceMode::unique, which compares
+    /// every frame.
+    std::size_t key_frames_{0};
+};
+
+struct ActorStatistics {
+    /// Microseconds between dequeuing a message and finishing processing it,
+    /// including any wait for the reorg lock or for coalesced messages to be
+    /// flushed. Messages deferred until init or a reorg completes are timed
+    /// from when they are taken out of the deferral queue.
+    Histogram::Buckets latency_{};
+    /// Number of messages received while a coalesced batch was pending
+    Histogram::Buckets queue_depth_{};
+    /// Number of messages which were merged into a previously queued message
+    std::uint64_t coalesced_{};
+};
+
 template <typename CRTP, typename JobType>
 class Actor : virtual public Allocated
 {
@@ -75,6 +109,15 @@ public:
     {
         return pipeline_.get_allocator();
     }
+    auto Statistics() const noexcept -> ActorStatistics
+    {
+        auto output = ActorStatistics{};
+        output.latency_ = latency_.Get();
+        output.queue_depth_ = queue_depth_.Get();
+        output.coalesced_ = coalesced_.load(std::memory_order_relaxed);
+
+        return output;
+    }
 
 protected:
     using Work = JobType;
@@ -155,6 +198,17 @@ protected:
         }
     }
     auto init_complete() noexcept -> void { init_promise_.set_value(); }
+    /// Process a run of consecutive coalesced messages of the same type
+    ///
+    /// Actors which can handle several messages more efficiently than one at
+    /// a time may provide their own version of this function.
+    auto pipeline_batch(const Work work, Vector<Message>&& batch) noexcept(
+        false) -> void
+    {
+        for (auto& message : batch) {
+            downcast().pipeline(work, std::move(message));
+        }
+    }
     auto shutdown_actor() noexcept -> void
     {
         init_future_.get();
@@ -176,7 +230,8 @@ protected:
         const network::zeromq::EndpointArgs& pull = {},
         const network::zeromq::EndpointArgs& dealer = {},
         const Vector<network::zeromq::SocketData>& extra = {},
-        Set<Work>&& neverDrop = {}) noexcept
+        Set<Work>&& neverDrop = {},
+        Map<Work, CoalesceRule>&& coalesce = {}) noexcept
         : name_(std::move(name))
         , log_(logger)
         , reorg_lock_()
@@ -191,6 +246,7 @@ protected:
         , disable_automatic_processing_(false)
         , rate_limit_(rateLimit)
         , never_drop_(std::move(neverDrop))
+        , coalesce_(std::move(coalesce))
         , init_promise_()
         , init_future_(init_promise_.get_future())
         , running_(true)
@@ -200,6 +256,13 @@ protected:
         , rng_(std::random_device{}())
         , delay_(50, 150)
         , retry_(api.Network().Asio().Internal().GetTimer())
+        , pending_(alloc)
+        , pending_index_(alloc)
+        , coalesce_queued_(false)
+        , received_since_flush_(0)
+        , coalesced_(0)
+        , latency_()
+        , queue_depth_()
     {
         log_(name_)(" ")(__FUNCTION__)(": using ZMQ batch ")(
             pipeline_.BatchID())
@@ -209,8 +272,15 @@ protected:
     ~Actor() override { retry_.Cancel(); }
 
 private:
+    struct Pending {
+        Work work_;
+        Message message_;
+        Time received_;
+    };
+
     const std::chrono::milliseconds rate_limit_;
     const Set<Work> never_drop_;
+    const Map<Work, CoalesceRule> coalesce_;
     std::promise<void> init_promise_;
     std::shared_future<void> init_future_;
     std::atomic<bool> running_;
@@ -220,7 +290,65 @@ private:
     std::mt19937 rng_;
     std::uniform_int_distribution<int> delay_;
     Timer retry_;
+    Vector<Pending> pending_;
+    Map<CString, std::size_t> pending_index_;
+    mutable std::atomic<bool> coalesce_queued_;
+    std::size_t received_since_flush_;
+    std::atomic<std::uint64_t> coalesced_;
+    Histogram latency_;
+    Histogram queue_depth_;
+
+    static auto elapsed(const Time since) noexcept -> std::uint64_t
+    {
+        const auto time =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - since)
+                .count();
+
+        return (0 < time) ? static_cast<std::uint64_t>(time) : 0u;
+    }
 
+    auto coalesce(
+        const Work work,
+        const CoalesceRule& rule,
+        const Time received,
+        Message&& in) noexcept -> void
+    {
+        auto key = [&] {
+            const auto body = in.Body();
+            const auto frames =
+                (CoalesceMode::unique == rule.mode_)
+                    ? body.size()
+                    : std::min(body.size(), rule.key_frames_ + 1u);
+            auto out = CString{get_allocator()};
+
+            for (auto n = std::size_t{0}; n < frames; ++n) {
+                const auto bytes = body.at(n).Bytes();
+                const auto size = std::to_string(bytes.size());
+                out.append(size.data(), size.size());
+                out.append(1u, ':');
+                out.append(bytes.data(), bytes.size());
+            }
+
+            return out;
+        }();
+        ++received_since_flush_;
+
+        if (auto i = pending_index_.find(key); pending_index_.end() != i) {
+            log_(name_)(" ")(__FUNCTION__)(": merging ")(print(work))(
+                " message with a queued message")
+                .Flush();
+            pending_.at(i->second).message_ = std::move(in);
+            coalesced_.fetch_add(1u, std::memory_order_relaxed);
+        } else {
+            pending_index_.try_emplace(std::move(key), pending_.size());
+            pending_.emplace_back(Pending{work, std::move(in), received});
+        }
+
+        if (false == coalesce_queued_.exchange(true)) {
+            pipeline_.Push(MakeWork(OT_ZMQ_COALESCE_SIGNAL));
+        }
+    }
     auto rate_limit_state_machine() const noexcept
     {
         const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
@@ -253,7 +381,10 @@ private:
                     "message does not contain a valid work tag"};
             }
         }();
-        const auto type = print(work);
+        const auto type = (OT_ZMQ_COALESCE_SIGNAL ==
+                           static_cast<OTZMQWorkType>(work))
+                              ? std::string_view{"coalesced messages"}
+                              : print(work);
         log_(name_)(" ")(__FUNCTION__)(": message type is: ")(type).Flush();
         const auto isInit =
             OT_ZMQ_INIT_SIGNAL == static_cast<OTZMQWorkType>(work);
@@ -266,8 +397,52 @@ private:
     {
         return static_cast<CRTP&>(*this);
     }
+    auto flush_coalesced() noexcept -> void
+    {
+        coalesce_queued_.store(false);
+
+        if (pending_.empty()) { return; }
+
+        auto pending = Vector<Pending>{get_allocator()};
+        pending.swap(pending_);
+        pending_index_.clear();
+        queue_depth_.Add(std::exchange(received_since_flush_, 0u));
+        log_(name_)(" ")(__FUNCTION__)(": processing ")(pending.size())(
+            " coalesced messages")
+            .Flush();
+
+        // NOTE pending messages are flushed before any message which is not
+        // coalesced is handled, so a held message is never overtaken by one
+        // which arrived after it. Merging updates a queued message in place
+        // so it keeps the position of the first message with the same key.
+        // Consecutive messages of the same type are delivered together.
+        for (auto i = pending.begin(), end = pending.end(); i != end;) {
+            const auto work = i->work_;
+            auto batch = Vector<Message>{get_allocator()};
+            auto received = Vector<Time>{get_allocator()};
+
+            for (; (i != end) && (i->work_ == work); ++i) {
+                batch.emplace_back(std::move(i->message_));
+                received.emplace_back(i->received_);
+            }
+
+            try {
+                downcast().pipeline_batch(work, std::move(batch));
+            } catch (const std::exception& e) {
+                log_(name_)(" ")(__FUNCTION__)(": error processing ")(
+                    print(work))(" messages: ")(e.what())
+                    .Flush();
+
+                OT_FAIL;
+            }
+
+            for (const auto& time : received) { latency_.Add(elapsed(time)); }
+        }
+    }
     auto handle_message(network::zeromq::Message&& in) noexcept -> void
     {
+        const auto received = Clock::now();
+
         try {
             const auto [work, type, isInit, canDrop, initFinished] =
                 decode_message_type(in);
@@ -281,6 +456,7 @@ private:
                 canDrop,
                 type,
                 work,
+                received,
                 std::move(in));
         } catch (const std::exception& e) {
             log_(name_)(" ")(__FUNCTION__)(": ")(e.what()).Flush();
@@ -293,6 +469,7 @@ private:
         const bool canDrop,
         const std::string_view type,
         const Work work,
+        const Time received,
         network::zeromq::Message&& in) noexcept -> void
     {
         if (false == initFinished) {
@@ -314,13 +491,27 @@ private:
                 log_(name_)(" ")(__FUNCTION__)(": processing ")(
                     type)(" in bypass mode")
                     .Flush();
-                handle_message(work, std::move(in));
+
+                flush_coalesced();
+
+                if (OT_ZMQ_COALESCE_SIGNAL !=
+                    static_cast<OTZMQWorkType>(work)) {
+                    handle_message(work, received, std::move(in));
+                }
 
                 return;
             } else if (topLevel) {
                 flush_cache();
             }
 
+            if (auto rule = coalesce_.find(work); coalesce_.end() != rule) {
+                coalesce(work, rule->second, received, std::move(in));
+
+                return;
+            }
+
+            flush_coalesced();
+
             switch (static_cast<OTZMQWorkType>(work)) {
                 case value(WorkType::Shutdown): {
                     log_(name_)(" ")(__FUNCTION__)(": shutting down").Flush();
@@ -331,16 +522,23 @@ private:
                         .Flush();
                     do_work();
                 } break;
+                case OT_ZMQ_COALESCE_SIGNAL: {
+                } break;
                 default: {
                     log_(name_)(" ")(__FUNCTION__)(": processing ")(type)
                         .Flush();
-                    handle_message(work, std::move(in));
+                    handle_message(work, received, std::move(in));
                 }
             }
         }
     }
-    auto handle_message(const Work work, Message&& msg) noexcept -> void
+    auto handle_message(
+        const Work work,
+        const Time received,
+        Message&& msg) noexcept -> void
     {
+        auto post = ScopeGuard{[&] { latency_.Add(elapsed(received)); }};
+
         try {
             downcast().pipeline(work, std::move(msg));
         } catch (const std::exception& e) {
@@ -372,6 +570,7 @@ private:
     }
     auto worker(network::zeromq::Message&& in) noexcept -> void
     {
+        const auto received = Clock::now();
         log_(name_)(" ")(__FUNCTION__)(": Message received").Flush();
 
         try {
@@ -423,7 +622,14 @@ private:
             }
 
             handle_message(
-                true, isInit, initFinished, canDrop, type, work, std::move(in));
+                true,
+                isInit,
+                initFinished,
+                canDrop,
+                type,
+                work,
+                received,
+                std::move(in));
         } catch (const std::exception& e) {
             log_(name_)(" ")(__FUNCTION__)(": ")(e.what()).Flush();
         }
@@ -0,0 +1,62 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"        // IWYU pragma: associated
+#include "1_Internal.hpp"      // IWYU pragma: associated
+#include "util/Histogram.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <atomic>
+
+namespace opentxs
+{
+Histogram::Histogram() noexcept
+    : buckets_()
+{
+    for (auto& bucket : buckets_) { bucket.store(0u); }
+}
+
+auto Histogram::Add(std::uint64_t value) noexcept -> void
+{
+    buckets_[Bucket(value)].fetch_add(1u, std::memory_order_relaxed);
+}
+
+auto Histogram::Bucket(std::uint64_t value) noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+
+    while (0u < value) {
+        ++output;
+        value >>= 1u;
+    }
+
+    return std::min(output, bucket_count_ - 1u);
+}
+
+auto Histogram::Count() const noexcept -> std::uint64_t
+{
+    auto output = std::uint64_t{0};
+
+    for (const auto& bucket : buckets_) {
+        output += bucket.load(std::memory_order_relaxed);
+    }
+
+    return output;
+}
+
+auto Histogram::Get() const noexcept -> Buckets
+{
+    auto output = Buckets{};
+    std::transform(
+        buckets_.begin(),
+        buckets_.end(),
+        output.begin(),
+        [](const auto& bucket) {
+            return bucket.load(std::memory_order_relaxed);
+        });
+
+    return output;
+}
+}  // namespace opentxs
@@ -0,0 +1,46 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace opentxs
+{
+/** Counts samples in power of two buckets
+ *
+ *  Bucket 0 counts samples with a value of zero and bucket n counts samples in
+ *  the range [2^(n-1), 2^n). The last bucket also counts every larger sample.
+ *  Samples may be added and read from any thread.
+ */
+class Histogram
+{
+public:
+    static constexpr auto bucket_count_ = std::size_t{32};
+
+    using Buckets = std::array<std::uint64_t, bucket_count_>;
+
+    static auto Bucket(std::uint64_t value) noexcept -> std::size_t;
+
+    auto Count() const noexcept -> std::uint64_t;
+    auto Get() const noexcept -> Buckets;
+
+    auto Add(std::uint64_t value) noexcept -> void;
+
+    Histogram() noexcept;
+    Histogram(const Histogram&) = delete;
+    Histogram(Histogram&&) = delete;
+    auto operator=(const Histogram&) -> Histogram& = delete;
+    auto operator=(Histogram&&) -> Histogram& = delete;
+
+    ~Histogram() = default;
+
+private:
+    std::array<std::atomic<std::uint64_t>, bucket_count_> buckets_;
+};
+}  // namespace opentxs
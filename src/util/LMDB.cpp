@@ -11,14 +11,19 @@ extern "C" {
 #include <lmdb.h>
 }
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <iterator>
 #include <limits>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <tuple>
 
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/Types.hpp"
 #include "util/FileSize.hpp"
 #include "util/ScopeGuard.hpp"
@@ -58,6 +63,12 @@ struct LMDB::Imp {
     }
     auto Delete(const Table table, MDB_txn* parent) const noexcept -> bool
     {
+        if (nullptr == parent) {
+            return group([&](auto* tx) {
+                       return Result{Delete(table, tx), 0};
+                   }).first;
+        }
+
         try {
             auto tx = TransactionRW(parent);
             auto& success = tx.success_;
@@ -79,6 +90,12 @@ struct LMDB::Imp {
     auto Delete(const Table table, const ReadView index, MDB_txn* parent)
         const noexcept -> bool
     {
+        if (nullptr == parent) {
+            return group([&](auto* tx) {
+                       return Result{Delete(table, index, tx), 0};
+                   }).first;
+        }
+
         try {
             auto tx = TransactionRW(parent);
             auto& success = tx.success_;
@@ -124,6 +141,12 @@ struct LMDB::Imp {
         const ReadView data,
         MDB_txn* parent) const noexcept -> bool
     {
+        if (nullptr == parent) {
+            return group([&](auto* tx) {
+                       return Result{Delete(table, index, data, tx), 0};
+                   }).first;
+        }
+
         try {
             auto tx = TransactionRW(parent);
             auto& success = tx.success_;
@@ -443,6 +466,13 @@ struct LMDB::Imp {
     {
         auto output = Result{false, MDB_LAST_ERRCODE};
         auto& [success, code] = output;
+
+        if (nullptr == parent) {
+            return group([&](auto* tx) {
+                return Store(table, index, data, tx, flags);
+            });
+        }
+
         auto transaction = TransactionRW(parent);
         auto post = ScopeGuard{[&] { transaction.success_ = output.first; }};
         const auto dbi = db_.at(table);
@@ -460,6 +490,12 @@ struct LMDB::Imp {
         MDB_txn* parent,
         const Flags flags) const noexcept -> Result
     {
+        if (nullptr == parent) {
+            return group([&](auto* tx) {
+                return StoreOrUpdate(table, index, cb, tx, flags);
+            });
+        }
+
         auto output = Result{false, MDB_LAST_ERRCODE};
 
         try {
@@ -503,9 +539,39 @@ struct LMDB::Imp {
 
         return output;
     }
+    auto OpenCursor(const Table table, MDB_txn* tx) const noexcept(false)
+        -> Cursor
+    {
+        return {tx, db_.at(table)};
+    }
     auto TransactionRO() const noexcept(false) -> Transaction
     {
-        return {env_, false, nullptr};
+        auto* reader = [&]() -> MDB_txn* {
+            auto lock = Lock{readers_lock_};
+            auto i = readers_.find(std::this_thread::get_id());
+
+            if (readers_.end() == i) { return nullptr; }
+
+            auto* out = i->second;
+            readers_.erase(i);
+
+            return out;
+        }();
+
+        if (nullptr != reader) {
+            if (0 == ::mdb_txn_renew(reader)) {
+
+                return {reader, [this](auto* tx) { release_reader(tx); }};
+            }
+
+            ::mdb_txn_abort(reader);
+        }
+
+        if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &reader)) {
+            throw std::runtime_error("Failed to start transaction");
+        }
+
+        return {reader, [this](auto* tx) { release_reader(tx); }};
     }
     auto TransactionRW(MDB_txn* parent) const noexcept(false) -> Transaction
     {
@@ -521,15 +587,25 @@ struct LMDB::Imp {
         const UnallocatedCString& folder,
         const TablesToInit init,
         const Flags flags,
-        const std::size_t extraTables) noexcept
+        const std::size_t extraTables,
+        const Durability durability) noexcept
         : names_(names)
+        , durability_(durability)
         , env_(nullptr)
         , db_()
         , pending_()
         , pending_lock_()
         , write_lock_()
+        , group_()
+        , group_lock_()
+        , last_sync_(Clock::now())
+        , readers_()
+        , readers_lock_()
     {
-        init_environment(folder, init.size() + extraTables, flags);
+        init_environment(
+            folder,
+            init.size() + extraTables,
+            (Durability::Sync == durability_) ? flags : (flags | MDB_NOSYNC));
         init_tables(init);
     }
     Imp(const Imp&) = delete;
@@ -543,13 +619,108 @@ private:
     using NewKey =
         std::tuple<Table, Mode, UnallocatedCString, UnallocatedCString>;
     using Pending = UnallocatedVector<NewKey>;
+    using Write = std::function<Result(MDB_txn*)>;
+
+    struct GroupWrite {
+        const Write write_;
+        Result result_;
+        bool done_;
+
+        GroupWrite(Write&& write) noexcept
+            : write_(std::move(write))
+            , result_(false, MDB_LAST_ERRCODE)
+            , done_(false)
+        {
+        }
+    };
+
+    static constexpr auto max_group_size_ = std::size_t{1024};
+    static constexpr auto sync_interval_ = std::chrono::seconds{1};
 
     const TableNames& names_;
+    const Durability durability_;
     mutable MDB_env* env_;
     mutable Databases db_;
     mutable Pending pending_;
     mutable std::mutex pending_lock_;
     mutable std::mutex write_lock_;
+    mutable UnallocatedDeque<GroupWrite*> group_;
+    mutable std::mutex group_lock_;
+    mutable Time last_sync_;
+    // NOTE idle read transactions which have been reset, one per thread
+    mutable UnallocatedMap<std::thread::id, MDB_txn*> readers_;
+    mutable std::mutex readers_lock_;
+
+    // NOTE write_lock_ must be held by the caller
+    auto commit_group() const noexcept -> void
+    {
+        auto batch = UnallocatedVector<GroupWrite*>{};
+
+        {
+            auto lock = Lock{group_lock_};
+            const auto count = std::min(group_.size(), max_group_size_);
+            batch.reserve(count);
+            const auto end = std::next(group_.begin(), count);
+            std::move(group_.begin(), end, std::back_inserter(batch));
+            group_.erase(group_.begin(), end);
+        }
+
+        try {
+            auto tx = Transaction{env_, true, nullptr};
+
+            for (auto* job : batch) { job->result_ = job->write_(tx); }
+
+            if (false == tx.Finalize(true)) {
+                throw std::runtime_error{"Failed to commit write group"};
+            }
+
+            sync();
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            for (auto* job : batch) {
+                job->result_ = Result{false, MDB_LAST_ERRCODE};
+            }
+        }
+
+        for (auto* job : batch) { job->done_ = true; }
+    }
+    // Writes which are not part of an explicit transaction are committed in
+    // groups. Every caller queues its write and then competes for the write
+    // lock. Whichever caller obtains it commits every queued write (up to
+    // max_group_size_) in a single transaction, each write in its own nested
+    // transaction so a failure only rolls back that write. Callers whose
+    // writes were committed by another thread return as soon as they
+    // acquire the lock.
+    auto group(Write&& write) const noexcept -> Result
+    {
+        auto job = GroupWrite{std::move(write)};
+
+        {
+            auto lock = Lock{group_lock_};
+            group_.emplace_back(&job);
+        }
+
+        auto lock = Lock{write_lock_};
+
+        while (false == job.done_) { commit_group(); }
+
+        return job.result_;
+    }
+    auto sync() const noexcept -> void
+    {
+        if (Durability::Periodic != durability_) { return; }
+
+        const auto now = Clock::now();
+
+        if ((now - last_sync_) < sync_interval_) { return; }
+
+        if (const auto rc = ::mdb_env_sync(env_, 1); 0 != rc) {
+            LogError()(OT_PRETTY_CLASS())(::mdb_strerror(rc)).Flush();
+        } else {
+            last_sync_ = now;
+        }
+    }
 
     auto init_db(const Table table, unsigned int flags) noexcept -> MDB_dbi
     {
@@ -642,9 +813,27 @@ private:
         }
     }
 
+    auto release_reader(MDB_txn* tx) const noexcept -> void
+    {
+        auto lock = Lock{readers_lock_};
+        const auto [i, added] =
+            readers_.try_emplace(std::this_thread::get_id(), tx);
+
+        if (false == added) { ::mdb_txn_abort(tx); }
+    }
     auto close_env() -> void
     {
+        {
+            auto lock = Lock{readers_lock_};
+
+            for (auto& [id, tx] : readers_) { ::mdb_txn_abort(tx); }
+
+            readers_.clear();
+        }
+
         if (nullptr != env_) {
+            if (Durability::Sync != durability_) { ::mdb_env_sync(env_, 1); }
+
             ::mdb_env_close(env_);
             env_ = nullptr;
         }
@@ -656,8 +845,15 @@ LMDB::LMDB(
     const UnallocatedCString& folder,
     const TablesToInit init,
     const Flags flags,
-    const std::size_t extraTables) noexcept
-    : imp_(std::make_unique<Imp>(names, folder, init, flags, extraTables))
+    const std::size_t extraTables,
+    const Durability durability) noexcept
+    : imp_(std::make_unique<Imp>(
+          names,
+          folder,
+          init,
+          flags,
+          extraTables,
+          durability))
 {
 }
 
@@ -674,6 +870,7 @@ LMDB::Transaction::Transaction(
     : success_(false)
     , lock_(std::move(lock))
     , ptr_(nullptr)
+    , release_()
 {
     const Flags flags = rw ? 0u : MDB_RDONLY;
 
@@ -682,10 +879,20 @@ LMDB::Transaction::Transaction(
     }
 }
 
+LMDB::Transaction::Transaction(MDB_txn* reader, Release&& release) noexcept
+    : success_(false)
+    , lock_(nullptr)
+    , ptr_(reader)
+    , release_(std::move(release))
+{
+    OT_ASSERT(nullptr != ptr_);
+}
+
 LMDB::Transaction::Transaction(Transaction&& rhs) noexcept
     : success_(rhs.success_)
     , lock_(std::move(rhs.lock_))
     , ptr_(rhs.ptr_)
+    , release_(std::move(rhs.release_))
 {
     rhs.ptr_ = nullptr;
 }
@@ -710,7 +917,12 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
 
         auto cleanup = Cleanup{ptr_};
 
-        if (success_) {
+        if (release_) {
+            ::mdb_txn_reset(ptr_);
+            release_(ptr_);
+
+            return true;
+        } else if (success_) {
 
             return 0 == ::mdb_txn_commit(ptr_);
         } else {
@@ -821,6 +1033,12 @@ auto LMDB::Load(
         mode);
 }
 
+auto LMDB::OpenCursor(const Table table, MDB_txn* tx) const noexcept(false)
+    -> Cursor
+{
+    return imp_->OpenCursor(table, tx);
+}
+
 auto LMDB::Queue(
     const Table table,
     const ReadView key,
@@ -922,4 +1140,131 @@ auto LMDB::TransactionRW(MDB_txn* parent) const noexcept(false) -> Transaction
 }
 
 LMDB::~LMDB() = default;
+
+LMDB::Cursor::Cursor(MDB_txn* tx, const MDB_dbi dbi) noexcept(false)
+    : cursor_(nullptr)
+    , key_()
+    , value_()
+    , paging_(false)
+{
+    if (0 != ::mdb_cursor_open(tx, dbi, &cursor_)) {
+        throw std::runtime_error{"Failed to get cursor"};
+    }
+}
+
+LMDB::Cursor::Cursor(Cursor&& rhs) noexcept
+    : cursor_(rhs.cursor_)
+    , key_(rhs.key_)
+    , value_(rhs.value_)
+    , paging_(rhs.paging_)
+{
+    rhs.cursor_ = nullptr;
+}
+
+auto LMDB::Cursor::Find(const ReadView key) noexcept -> bool
+{
+    return get(key, MDB_SET_KEY);
+}
+
+auto LMDB::Cursor::First() noexcept -> bool { return get(MDB_FIRST); }
+
+auto LMDB::Cursor::get(const int op) noexcept -> bool
+{
+    auto key = MDB_val{};
+    auto value = MDB_val{};
+    paging_ = false;
+
+    const auto rc = ::mdb_cursor_get(
+        cursor_, &key, &value, static_cast<MDB_cursor_op>(op));
+
+    if (0 == rc) {
+        key_ = {static_cast<const char*>(key.mv_data), key.mv_size};
+        value_ = {static_cast<const char*>(value.mv_data), value.mv_size};
+
+        return true;
+    } else {
+        key_ = {};
+        value_ = {};
+
+        return false;
+    }
+}
+
+auto LMDB::Cursor::get(const ReadView key, const int op) noexcept -> bool
+{
+    auto k = MDB_val{key.size(), const_cast<char*>(key.data())};
+    auto value = MDB_val{};
+    paging_ = false;
+
+    const auto rc = ::mdb_cursor_get(
+        cursor_, &k, &value, static_cast<MDB_cursor_op>(op));
+
+    if (0 == rc) {
+        key_ = {static_cast<const char*>(k.mv_data), k.mv_size};
+        value_ = {static_cast<const char*>(value.mv_data), value.mv_size};
+
+        return true;
+    } else {
+        key_ = {};
+        value_ = {};
+
+        return false;
+    }
+}
+
+auto LMDB::Cursor::Last() noexcept -> bool { return get(MDB_LAST); }
+
+auto LMDB::Cursor::Next() noexcept -> bool { return get(MDB_NEXT); }
+
+auto LMDB::Cursor::NextDuplicate() noexcept -> bool
+{
+    return get(MDB_NEXT_DUP);
+}
+
+auto LMDB::Cursor::NextKey() noexcept -> bool
+{
+    return get(MDB_NEXT_NODUP);
+}
+
+auto LMDB::Cursor::NextPage() noexcept -> bool
+{
+    auto key = MDB_val{};
+    auto value = MDB_val{};
+    const auto op = paging_ ? MDB_NEXT_MULTIPLE : MDB_GET_MULTIPLE;
+    const auto rc = ::mdb_cursor_get(cursor_, &key, &value, op);
+
+    if (0 != rc) { return false; }
+
+    if (false == paging_) {
+        paging_ = true;
+
+        // NOTE MDB_GET_MULTIPLE does not set the value when the key has a
+        // single duplicate
+        if (nullptr == value.mv_data) {
+            const auto current =
+                ::mdb_cursor_get(cursor_, &key, &value, MDB_GET_CURRENT);
+
+            if (0 != current) { return false; }
+        }
+    }
+
+    value_ = {static_cast<const char*>(value.mv_data), value.mv_size};
+
+    return true;
+}
+
+auto LMDB::Cursor::Previous() noexcept -> bool { return get(MDB_PREV); }
+
+auto LMDB::Cursor::Seek(const ReadView key) noexcept -> bool
+{
+    return get(key, MDB_SET_RANGE);
+}
+
+LMDB::Cursor::~Cursor()
+{
+    if (nullptr != cursor_) {
+        ::mdb_cursor_close(cursor_);
+        cursor_ = nullptr;
+    }
+}
 }  // namespace opentxs::storage::lmdb
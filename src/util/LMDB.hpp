@@ -20,6 +20,7 @@
 #include "opentxs/util/Container.hpp"
 
 extern "C" {
+typedef struct MDB_cursor MDB_cursor;
 typedef struct MDB_env MDB_env;
 typedef struct MDB_txn MDB_txn;
 typedef unsigned int MDB_dbi;
@@ -43,8 +44,22 @@ class LMDB
 public:
     enum class Dir : bool { Forward = false, Backward = true };
     enum class Mode : bool { One = false, Multiple = true };
+    /// Controls when committed transactions are flushed to disk
+    enum class Durability {
+        /// Every commit is flushed before it returns
+        Sync,
+        /// Commits are not flushed individually. The environment is flushed
+        /// after a commit if at least one second has passed since the
+        /// previous flush, and when the database is closed.
+        Periodic,
+        /// Flushing is left to the operating system until the database is
+        /// closed
+        NoSync,
+    };
 
     struct Transaction {
+        using Release = std::function<void(MDB_txn*)>;
+
         bool success_;
 
         operator MDB_txn*() noexcept { return ptr_; }
@@ -56,6 +71,9 @@ public:
             const bool rw,
             std::unique_ptr<Lock> lock,
             MDB_txn* parent = nullptr) noexcept(false);
+        /// Wraps an active read transaction which is reset and handed to
+        /// release instead of being aborted when it is finalized
+        Transaction(MDB_txn* reader, Release&& release) noexcept;
         Transaction(Transaction&&) noexcept;
 
         ~Transaction();
@@ -63,12 +81,62 @@ public:
     private:
         std::unique_ptr<Lock> lock_;
         MDB_txn* ptr_;
+        Release release_;
 
         Transaction(const Transaction&) = delete;
         auto operator=(const Transaction&) -> Transaction& = delete;
         auto operator=(Transaction&&) -> Transaction& = delete;
     };
 
+    /// Positions over a table inside an existing transaction
+    ///
+    /// Every positioning function returns false if no record exists at the
+    /// requested position, in which case Key() and Value() are empty.
+    class Cursor
+    {
+    public:
+        auto Key() const noexcept -> ReadView { return key_; }
+        auto Value() const noexcept -> ReadView { return value_; }
+
+        /// Moves to the first record of the table
+        auto First() noexcept -> bool;
+        /// Moves to the first duplicate of the specified key
+        auto Find(const ReadView key) noexcept -> bool;
+        /// Moves to the last record of the table
+        auto Last() noexcept -> bool;
+        auto Next() noexcept -> bool;
+        /// Moves to the next duplicate of the current key
+        auto NextDuplicate() noexcept -> bool;
+        /// Moves to the first duplicate of the next key
+        auto NextKey() noexcept -> bool;
+        /// Returns up to a page of the remaining duplicates of the current
+        /// key in an MDB_DUPFIXED table. Value() is the concatenation of the
+        /// values and each value is ElementSize() bytes long.
+        auto NextPage() noexcept -> bool;
+        auto Previous() noexcept -> bool;
+        /// Moves to the first record whose key is greater than or equal to
+        /// the argument
+        auto Seek(const ReadView key) noexcept -> bool;
+
+        Cursor(MDB_txn* tx, const MDB_dbi dbi) noexcept(false);
+        Cursor(Cursor&& rhs) noexcept;
+
+        ~Cursor();
+
+    private:
+        MDB_cursor* cursor_;
+        ReadView key_;
+        ReadView value_;
+        bool paging_;
+
+        auto get(const int op) noexcept -> bool;
+        auto get(const ReadView key, const int op) noexcept -> bool;
+
+        Cursor(const Cursor&) = delete;
+        auto operator=(const Cursor&) -> Cursor& = delete;
+        auto operator=(Cursor&&) -> Cursor& = delete;
+    };
+
     auto Commit() const noexcept -> bool;
     auto Delete(const Table table, MDB_txn* parent = nullptr) const noexcept
         -> bool;
@@ -116,6 +184,8 @@ public:
         const std::size_t key,
         const Callback cb,
         const Mode mode = Mode::One) const noexcept -> bool;
+    auto OpenCursor(const Table table, MDB_txn* tx) const noexcept(false)
+        -> Cursor;
     auto Queue(
         const Table table,
         const ReadView key,
@@ -133,6 +203,30 @@ public:
         const ReadCallback cb,
         MDB_txn& tx,
         const UnallocatedCString& message) const noexcept -> bool;
+    /// Calls cb for every record of an MDB_DUPFIXED table, retrieving the
+    /// duplicates of each key a page at a time. cb returns false to stop.
+    template <typename CB>
+    auto ReadFixed(const Table table, CB&& cb, MDB_txn* tx) const
+        noexcept(false) -> void
+    {
+        auto cursor = OpenCursor(table, tx);
+
+        for (auto more = cursor.First(); more; more = cursor.NextKey()) {
+            const auto key = cursor.Key();
+            const auto size = cursor.Value().size();
+
+            if (0u == size) { continue; }
+
+            while (cursor.NextPage()) {
+                const auto page = cursor.Value();
+
+                for (auto i = std::size_t{0}; (i + size) <= page.size();
+                     i += size) {
+                    if (false == cb(key, page.substr(i, size))) { return; }
+                }
+            }
+        }
+    }
     auto ReadFrom(
         const Table table,
         const ReadView key,
@@ -143,6 +237,45 @@ public:
         const std::size_t key,
         const ReadCallback cb,
         const Dir dir) const noexcept -> bool;
+    /// Calls cb for every record whose key starts with prefix. cb returns
+    /// false to stop.
+    template <typename CB>
+    auto ReadPrefix(
+        const Table table,
+        const ReadView prefix,
+        CB&& cb,
+        MDB_txn* tx) const noexcept(false) -> void
+    {
+        auto cursor = OpenCursor(table, tx);
+
+        for (auto more = cursor.Seek(prefix); more; more = cursor.Next()) {
+            const auto key = cursor.Key();
+
+            if (key.substr(0, prefix.size()) != prefix) { return; }
+
+            if (false == cb(key, cursor.Value())) { return; }
+        }
+    }
+    /// Calls cb for every record whose key is in [from, to) in the byte order
+    /// of the table. cb returns false to stop.
+    template <typename CB>
+    auto ReadRange(
+        const Table table,
+        const ReadView from,
+        const ReadView to,
+        CB&& cb,
+        MDB_txn* tx) const noexcept(false) -> void
+    {
+        auto cursor = OpenCursor(table, tx);
+
+        for (auto more = cursor.Seek(from); more; more = cursor.Next()) {
+            const auto key = cursor.Key();
+
+            if (key >= to) { return; }
+
+            if (false == cb(key, cursor.Value())) { return; }
+        }
+    }
     auto Store(
         const Table table,
         const ReadView key,
@@ -170,7 +303,8 @@ public:
         const UnallocatedCString& folder,
         const TablesToInit init,
         const Flags flags = 0,
-        const std::size_t extraTables = 0)
+        const std::size_t extraTables = 0,
+        const Durability durability = Durability::Sync)
     noexcept;
     // NOTE: move constructor is only defined to allow copy elision. It
     // should not be used for any other purpose.
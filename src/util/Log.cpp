@@ -16,7 +16,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <future>
+#include <iostream>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <thread>
 
 #include "internal/core/Amount.hpp"
@@ -24,8 +27,6 @@
 #include "internal/otx/common/util/Common.hpp"
 #include "internal/util/Log.hpp"
 #include "internal/util/Mutex.hpp"
-#include "opentxs/OT.hpp"
-#include "opentxs/api/Context.hpp"
 #include "opentxs/core/Amount.hpp"
 #include "opentxs/core/Armored.hpp"
 #include "opentxs/core/String.hpp"
@@ -36,24 +37,17 @@
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
-#include "opentxs/network/zeromq/Context.hpp"
-#include "opentxs/network/zeromq/ZeroMQ.hpp"
-#include "opentxs/network/zeromq/message/Message.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
-#include "opentxs/network/zeromq/socket/Types.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Pimpl.hpp"
 #include "util/Log.hpp"
 
-namespace zmq = opentxs::network::zeromq;
-
 namespace opentxs::internal
 {
-auto Log::Endpoint() noexcept -> const char*
+auto Log::Dropped() noexcept -> std::size_t
 {
-    static const auto output = zmq::MakeDeterministicInproc("logsink", -1, 1);
+    static auto& logger = opentxs::Log::Imp::logger_;
 
-    return output.c_str();
+    return logger.dropped_.load();
 }
 
 auto Log::SetVerbosity(const int level) noexcept -> void
@@ -66,15 +60,166 @@ auto Log::Shutdown() noexcept -> void
 {
     static auto& logger = opentxs::Log::Imp::logger_;
     logger.running_.shutdown();
+    logger.Stop();
     auto lock = Lock{logger.lock_};
     logger.map_.clear();
 }
 
-auto Log::Start() noexcept -> void {}
+auto Log::Start(Sink&& sink) noexcept -> void
+{
+    static auto& logger = opentxs::Log::Imp::logger_;
+    logger.Start(std::move(sink));
+}
 }  // namespace opentxs::internal
 
 namespace opentxs
 {
+Log::Imp::Logger::Ring::Ring(UnallocatedCString&& id) noexcept
+    : id_(std::move(id))
+    , dropped_(0)
+    , closed_(false)
+    , records_()
+    , head_(0)
+    , tail_(0)
+{
+}
+
+auto Log::Imp::Logger::Ring::Drain(const Sink& sink) noexcept -> std::size_t
+{
+    if (const auto dropped = dropped_.exchange(0); 0u < dropped) {
+        if (sink) {
+            const auto text = std::to_string(dropped).append(
+                " log messages dropped because the buffer was full");
+            sink(-1, text, id_);
+        }
+    }
+
+    const auto head = head_.load(std::memory_order_acquire);
+    auto tail = tail_.load(std::memory_order_relaxed);
+    const auto count = head - tail;
+
+    while (tail != head) {
+        auto& record = records_[tail % capacity_];
+
+        if (sink && (false == record.text_.empty())) {
+            sink(record.level_, record.text_, id_);
+        }
+
+        if (nullptr != record.promise_) {
+            record.promise_->set_value();
+            record.promise_ = nullptr;
+        }
+
+        tail_.store(++tail, std::memory_order_release);
+    }
+
+    return count;
+}
+
+auto Log::Imp::Logger::Ring::Empty() const noexcept -> bool
+{
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
+}
+
+auto Log::Imp::Logger::Ring::Push(
+    const int level,
+    const std::string_view text,
+    std::promise<void>* promise) noexcept -> bool
+{
+    const auto head = head_.load(std::memory_order_relaxed);
+
+    if (capacity_ <= (head - tail_.load(std::memory_order_acquire))) {
+
+        return false;
+    }
+
+    auto& record = records_[head % capacity_];
+    record.level_ = level;
+    record.text_.assign(text);
+    record.promise_ = promise;
+    head_.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+auto Log::Imp::Logger::Notify() noexcept -> void
+{
+    if (idle_.load()) { wake_.notify_one(); }
+}
+
+auto Log::Imp::Logger::run() noexcept -> void
+{
+    static constexpr auto idle = 10ms;
+    auto rings = UnallocatedVector<std::shared_ptr<Ring>>{};
+
+    while (true) {
+        auto stop{false};
+        rings.clear();
+
+        {
+            auto lock = Lock{lock_};
+            stop = stop_;
+
+            for (auto i = map_.begin(); i != map_.end();) {
+                const auto& ring = i->second;
+
+                if (ring->closed_.load() && ring->Empty()) {
+                    i = map_.erase(i);
+                } else {
+                    rings.emplace_back(ring);
+                    ++i;
+                }
+            }
+        }
+
+        auto processed = std::size_t{0};
+
+        for (const auto& ring : rings) { processed += ring->Drain(sink_); }
+
+        if (stop) { break; }
+
+        if (0u == processed) {
+            auto lock = Lock{lock_};
+            idle_.store(true);
+
+            if (false == stop_) { wake_.wait_for(lock, idle); }
+
+            idle_.store(false);
+        }
+    }
+}
+
+auto Log::Imp::Logger::Start(Sink&& sink) noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    if (consumer_.joinable()) { return; }
+
+    sink_ = std::move(sink);
+    stop_ = false;
+    consumer_ = std::thread{&Logger::run, this};
+    started_.store(true);
+}
+
+auto Log::Imp::Logger::Stop() noexcept -> void
+{
+    {
+        auto lock = Lock{lock_};
+
+        if (false == consumer_.joinable()) { return; }
+
+        stop_ = true;
+    }
+
+    wake_.notify_one();
+    consumer_.join();
+    started_.store(false);
+    sink_ = {};
+}
+
+Log::Imp::Logger::~Logger() { Stop(); }
+
 Log::Imp::Logger Log::Imp::logger_{};
 
 Log::Imp::Imp(const int logLevel, opentxs::Log& parent) noexcept
@@ -85,7 +230,7 @@ Log::Imp::Imp(const int logLevel, opentxs::Log& parent) noexcept
 
 auto Log::Imp::active() const noexcept -> bool
 {
-    return logger_.verbosity_.load() >= level_;
+    return logger_.verbosity_.load(std::memory_order_relaxed) >= level_;
 }
 
 auto Log::Imp::Assert(
@@ -94,9 +239,7 @@ auto Log::Imp::Assert(
     const char* message) const noexcept -> void
 {
     if (auto done = logger_.running_.get(); false == done) {
-        auto id = UnallocatedCString{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
+        auto buffer = std::stringstream{};
         buffer << "OT ASSERT";
 
         if (nullptr != file) { buffer << " in " << file << " line " << line; }
@@ -104,6 +247,8 @@ auto Log::Imp::Assert(
         if (nullptr != message) { buffer << ": " << message; }
 
         buffer << "\n" << boost::stacktrace::stacktrace();
+        auto& text = get_buffer().text_;
+        text = buffer.str();
     }
 
     send(true);
@@ -112,57 +257,38 @@ auto Log::Imp::Assert(
 
 auto Log::Imp::Flush() const noexcept -> void { send(false); }
 
-auto Log::Imp::get_buffer(UnallocatedCString& out) noexcept -> Logger::Source&
+auto Log::Imp::get_buffer() noexcept -> Logger::Source&
 {
     struct Buffer {
-        const std::thread::id id_;
-        const UnallocatedCString text_;
         const int index_;
-        Logger::SourceMap::iterator source_;
+        Logger::Source source_;
 
         Buffer() noexcept
-            : id_(std::this_thread::get_id())
-            , text_([&] {
+            : index_(++logger_.index_)
+            , source_{std::make_shared<Logger::Ring>([] {
                 auto buf = std::stringstream{};
-                buf << std::hex << id_;
+                buf << std::hex << std::this_thread::get_id();
 
                 return buf.str();
-            }())
-            , index_(++logger_.index_)
-            , source_([&] {
-                auto lock = Lock{logger_.lock_};
-                auto [it, added] = logger_.map_.try_emplace(
-                    index_,
-                    [] {
-                        using Direction = zmq::socket::Direction;
-                        auto out =
-                            Context().ZMQ().PushSocket(Direction::Connect);
-                        const auto started =
-                            out->Start(internal::Log::Endpoint());
-
-                        assert(started);
-
-                        return out;
-                    }(),
-                    std::stringstream{});
-                assert(added);
-
-                return it;
-            }())
+            }()), {}}
         {
+            auto lock = Lock{logger_.lock_};
+            const auto [it, added] =
+                logger_.map_.try_emplace(index_, source_.ring_);
+
+            assert(added);
         }
 
         ~Buffer()
         {
-            auto lock = Lock{logger_.lock_};
-            logger_.map_.erase(index_);
+            source_.ring_->closed_.store(true);
+            logger_.Notify();
         }
     };
 
     static thread_local auto buffer = Buffer{};
-    out = buffer.text_;
 
-    return buffer.source_->second;
+    return buffer.source_;
 }
 
 auto Log::Imp::operator()(const std::string_view in) const noexcept
@@ -170,10 +296,8 @@ auto Log::Imp::operator()(const std::string_view in) const noexcept
 {
     if (false == active()) { return parent_; }
 
-    auto id = UnallocatedCString{};
-
     if (auto done = logger_.running_.get(); false == done) {
-        std::get<1>(get_buffer(id)) << in;
+        get_buffer().text_.append(in);
     }
 
     return parent_;
@@ -184,10 +308,8 @@ auto Log::Imp::operator()(const boost::system::error_code& error) const noexcept
 {
     if (false == active()) { return parent_; }
 
-    auto id = UnallocatedCString{};
-
     if (auto done = logger_.running_.get(); false == done) {
-        std::get<1>(get_buffer(id)) << error.message();
+        get_buffer().text_.append(error.message());
     }
 
     return parent_;
@@ -195,27 +317,45 @@ auto Log::Imp::operator()(const boost::system::error_code& error) const noexcept
 
 auto Log::Imp::send(const bool terminate) const noexcept -> void
 {
+    if ((false == terminate) && (false == active())) { return; }
+
     if (auto done = logger_.running_.get(); false == done) {
-        auto id = UnallocatedCString{};
-        auto& [socket, buffer] = get_buffer(id);
-        auto message = zmq::Message{};
-        message.StartBody();
-        message.AddFrame(level_);
-        message.AddFrame(buffer.str());
-        message.AddFrame(id);
-        auto promise = std::promise<void>{};
-        auto future = promise.get_future();
-        const auto* pPromise = &promise;
+        auto& [ring, text] = get_buffer();
 
         if (terminate) {
-            message.AddFrame(&pPromise, sizeof(pPromise));
-        } else {
-            promise.set_value();
+            // NOTE an assert must not be lost, so wait for space in the ring
+            // for as long as a consumer exists to make some
+            static constexpr auto limit = 10s;
+            const auto deadline = Clock::now() + limit;
+            auto promise = std::promise<void>{};
+            auto future = promise.get_future();
+            auto queued{false};
+
+            while (logger_.started_.load() && (Clock::now() < deadline)) {
+                queued = ring->Push(level_, text, &promise);
+
+                if (queued) { break; }
+
+                logger_.Notify();
+                std::this_thread::yield();
+            }
+
+            if (queued) {
+                logger_.Notify();
+                future.wait_for(limit);
+            } else {
+                std::cerr << text << std::endl;
+            }
+        } else if (false == text.empty()) {
+            if (ring->Push(level_, text, nullptr)) {
+                logger_.Notify();
+            } else {
+                ring->dropped_.fetch_add(1);
+                logger_.dropped_.fetch_add(1);
+            }
         }
 
-        socket->Send(std::move(message));
-        buffer = std::stringstream{};
-        future.wait_for(10s);
+        text.clear();
     }
 
     if (terminate) { abort(); }
@@ -226,10 +366,10 @@ auto Log::Imp::Trace(
     const std::size_t line,
     const char* message) const noexcept -> void
 {
+    if (false == active()) { return; }
+
     if (auto done = logger_.running_.get(); false == done) {
-        UnallocatedCString id{};
-        auto& [socket, buffer] = get_buffer(id);
-        buffer = std::stringstream{};
+        auto buffer = std::stringstream{};
         buffer << "Stack trace requested";
 
         if (nullptr != file) { buffer << " in " << file << " line " << line; }
@@ -237,6 +377,8 @@ auto Log::Imp::Trace(
         if (nullptr != message) { buffer << ": " << message; }
 
         buffer << "\n" << PrintStackTrace();
+        auto& text = get_buffer().text_;
+        text = buffer.str();
     }
 
     send(false);
@@ -254,11 +396,15 @@ auto Log::operator()() const noexcept -> const Log& { return *this; }
 
 auto Log::operator()(char* in) const noexcept -> const Log&
 {
+    if (false == imp_->active()) { return *this; }
+
     return operator()(std::string_view{in, std::strlen(in)});
 }
 
 auto Log::operator()(const char* in) const noexcept -> const Log&
 {
+    if (false == imp_->active()) { return *this; }
+
     return operator()(std::string_view{in, std::strlen(in)});
 }
 
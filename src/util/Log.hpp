@@ -5,14 +5,15 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <future>
+#include <memory>
 #include <mutex>
-#include <sstream>
 #include <string_view>
 #include <thread>
-#include <tuple>
-#include <utility>
 
 #include "internal/otx/common/StringXML.hpp"
 #include "internal/util/Log.hpp"
@@ -22,7 +23,6 @@
 #include "opentxs/core/identifier/Notary.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Time.hpp"
@@ -40,14 +40,66 @@ namespace opentxs
 {
 struct Log::Imp final : public internal::Log {
     struct Logger {
-        using Source = std::pair<OTZMQPushSocket, std::stringstream>;
-        using SourceMap = UnallocatedMap<int, Source>;
+        /// Finished records written by a single thread and read by the
+        /// consumer thread. Slots retain their capacity so that producers do
+        /// not allocate once the ring has warmed up.
+        struct Ring {
+            struct Record {
+                int level_{};
+                UnallocatedCString text_{};
+                std::promise<void>* promise_{};
+            };
+
+            static constexpr auto capacity_ = std::size_t{256};
+
+            const UnallocatedCString id_;
+            std::atomic<std::size_t> dropped_;
+            std::atomic_bool closed_;
+
+            auto Empty() const noexcept -> bool;
+
+            auto Drain(const Sink& sink) noexcept -> std::size_t;
+            auto Push(
+                const int level,
+                const std::string_view text,
+                std::promise<void>* promise) noexcept -> bool;
+
+            Ring(UnallocatedCString&& id) noexcept;
+
+        private:
+            std::array<Record, capacity_> records_;
+            std::atomic<std::size_t> head_;
+            std::atomic<std::size_t> tail_;
+        };
+
+        struct Source {
+            const std::shared_ptr<Ring> ring_;
+            UnallocatedCString text_;
+        };
+
+        using RingMap = UnallocatedMap<int, std::shared_ptr<Ring>>;
 
         std::atomic_int verbosity_{-1};
         std::atomic_int index_{-1};
+        std::atomic<std::size_t> dropped_{};
+        std::atomic_bool idle_{};
+        std::atomic_bool started_{};
         Gatekeeper running_{};
         std::mutex lock_{};
-        SourceMap map_{};
+        std::condition_variable wake_{};
+        RingMap map_{};
+        Sink sink_{};
+        bool stop_{};
+        std::thread consumer_{};
+
+        auto Notify() noexcept -> void;
+        auto Start(Sink&& sink) noexcept -> void;
+        auto Stop() noexcept -> void;
+
+        ~Logger();
+
+    private:
+        auto run() noexcept -> void;
     };
 
     static Logger logger_;
@@ -74,7 +126,7 @@ private:
     const int level_;
     opentxs::Log& parent_;
 
-    static auto get_buffer(UnallocatedCString& id) noexcept -> Logger::Source&;
+    static auto get_buffer() noexcept -> Logger::Source&;
 
     auto send(const bool terminate) const noexcept -> void;
 
@@ -10,15 +10,22 @@
 #include <boost/filesystem.hpp>
 #include <boost/iostreams/device/mapped_file.hpp>
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
 #include "internal/util/TSV.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "util/ByteLiterals.hpp"
 #include "util/FileSize.hpp"
 
 namespace fs = boost::filesystem;
@@ -46,16 +53,287 @@ constexpr auto get_start_position(const std::size_t file) noexcept
     return file * mapped_file_size();
 }
 
+constexpr auto same_file(
+    const std::size_t position,
+    const std::size_t size) noexcept -> bool
+{
+    return get_offset(position).first ==
+           get_offset(position + (size - 1u)).first;
+}
+
+// Counts the readers which started in each epoch. A compaction pass stamps the
+// space it releases with the current epoch and then starts a new one, so the
+// space is unreachable once no reader from that epoch or an earlier one
+// remains.
+class FileStorageEpochs
+{
+public:
+    auto Oldest() const noexcept -> std::uint64_t
+    {
+        auto lock = Lock{lock_};
+
+        return readers_.empty() ? current_ : readers_.begin()->first;
+    }
+
+    auto Advance() noexcept -> std::uint64_t
+    {
+        auto lock = Lock{lock_};
+
+        return current_++;
+    }
+    auto Enter() noexcept -> std::uint64_t
+    {
+        auto lock = Lock{lock_};
+        ++readers_[current_];
+
+        return current_;
+    }
+    auto Exit(const std::uint64_t epoch) noexcept -> void
+    {
+        auto lock = Lock{lock_};
+        auto i = readers_.find(epoch);
+
+        OT_ASSERT(readers_.end() != i);
+        OT_ASSERT(0u < i->second);
+
+        if (0u == --(i->second)) { readers_.erase(i); }
+    }
+
+    FileStorageEpochs() noexcept
+        : lock_()
+        , current_(0)
+        , readers_()
+    {
+    }
+
+    ~FileStorageEpochs() = default;
+
+private:
+    mutable std::mutex lock_;
+    std::uint64_t current_;
+    UnallocatedMap<std::uint64_t, std::size_t> readers_;
+
+    FileStorageEpochs(const FileStorageEpochs&) = delete;
+    FileStorageEpochs(FileStorageEpochs&&) = delete;
+    auto operator=(const FileStorageEpochs&) -> FileStorageEpochs& = delete;
+    auto operator=(FileStorageEpochs&&) -> FileStorageEpochs& = delete;
+};
+
+FileStorageReader::FileStorageReader(
+    std::shared_ptr<FileStorageEpochs> epochs) noexcept
+    : epochs_(std::move(epochs))
+    , epoch_([&] {
+        OT_ASSERT(epochs_);
+
+        return epochs_->Enter();
+    }())
+{
+}
+
+FileStorageReader::FileStorageReader(FileStorageReader&& rhs) noexcept
+    : epochs_(std::move(rhs.epochs_))
+    , epoch_(rhs.epoch_)
+{
+}
+
+FileStorageReader::~FileStorageReader()
+{
+    if (epochs_) { epochs_->Exit(epoch_); }
+}
+
+FreeSpace::FreeSpace(const storage::lmdb::LMDB& lmdb, const int table) noexcept
+    : lmdb_(&lmdb)
+    , table_(table)
+    , extents_()
+    , by_size_()
+    , bytes_(0)
+{
+}
+
+auto FreeSpace::Add(
+    storage::lmdb::LMDB::Transaction& tx,
+    Position position,
+    Size size) noexcept -> bool
+{
+    if (0u == size) { return true; }
+
+    const auto original = position;
+    const auto end = position + size;
+
+    if (auto i = extents_.lower_bound(position); extents_.begin() != i) {
+        const auto prev = std::prev(i);
+        const auto& [start, bytes] = *prev;
+
+        if (((start + bytes) == position) && same_file(start, bytes + size)) {
+            position = start;
+            size += bytes;
+            erase(tx, prev);
+        }
+    }
+
+    if (auto i = extents_.find(end); extents_.end() != i) {
+        const auto bytes = i->second;
+
+        if (same_file(position, size + bytes)) {
+            size += bytes;
+            erase(tx, i);
+        }
+    }
+
+    if (position != original) {
+        // NOTE the extent may already have been recorded when it was freed
+        lmdb_->Delete(table_, original, tx);
+    }
+
+    return insert(tx, position, size);
+}
+
+auto FreeSpace::Contains(const Position position) const noexcept -> bool
+{
+    auto i = extents_.upper_bound(position);
+
+    if (extents_.begin() == i) { return false; }
+
+    const auto& [start, size] = *std::prev(i);
+
+    return position < (start + size);
+}
+
+auto FreeSpace::erase(
+    storage::lmdb::LMDB::Transaction& tx,
+    Extents::iterator i) noexcept -> void
+{
+    const auto [position, size] = *i;
+    // NOTE the only expected failure is a missing record, which happens if the
+    // transaction which created it was never committed
+    lmdb_->Delete(table_, position, tx);
+    by_size_.erase({size, position});
+    extents_.erase(i);
+    bytes_ -= size;
+}
+
+auto FreeSpace::First() const noexcept -> std::optional<Position>
+{
+    if (extents_.empty()) { return std::nullopt; }
+
+    return extents_.begin()->first;
+}
+
+auto FreeSpace::Import(const Position position, const Size size) noexcept
+    -> void
+{
+    extents_.emplace(position, size);
+    by_size_.emplace(size, position);
+    bytes_ += size;
+}
+
+auto FreeSpace::insert(
+    storage::lmdb::LMDB::Transaction& tx,
+    const Position position,
+    const Size size) noexcept -> bool
+{
+    const auto result = lmdb_->Store(table_, position, tsv(size), tx);
+
+    if (false == result.first) {
+        LogError()(OT_PRETTY_CLASS())("Failed to record free extent").Flush();
+
+        return false;
+    }
+
+    Import(position, size);
+
+    return true;
+}
+
+auto FreeSpace::Take(
+    storage::lmdb::LMDB::Transaction& tx,
+    const Size size,
+    const Position before) noexcept -> std::optional<Position>
+{
+    for (auto i = by_size_.lower_bound({size, 0u}); by_size_.end() != i; ++i) {
+        const auto [bytes, position] = *i;
+
+        if (position >= before) { continue; }
+
+        erase(tx, extents_.find(position));
+
+        if (bytes > size) {
+            if (false == insert(tx, position + size, bytes - size)) {
+                return std::nullopt;
+            }
+        }
+
+        return position;
+    }
+
+    return std::nullopt;
+}
+
+auto FreeSpace::TrimEnd(
+    storage::lmdb::LMDB::Transaction& tx,
+    const Position end) noexcept -> std::optional<Position>
+{
+    if (extents_.empty()) { return std::nullopt; }
+
+    const auto last = std::prev(extents_.end());
+    const auto [position, size] = *last;
+
+    if ((position + size) != end) { return std::nullopt; }
+
+    erase(tx, last);
+
+    return position;
+}
+
 struct MappedFileStorage::Imp {
     using FileCounter = std::size_t;
+    using Extents = FreeSpace::Extents;
+
+    struct Candidate {
+        int table_;
+        Space key_;
+        Space value_;
+        IndexData index_;
+    };
+    // NOTE the progress of a scan of the index tables which is spread across
+    // several compaction passes. Candidates are only relocated once the scan
+    // has examined every index entry, since an item which is referenced by
+    // more than one entry must not be relocated.
+    struct ScanState {
+        std::size_t table_{};
+        Space key_{};
+        UnallocatedMap<IndexData::MemoryPosition, Candidate> candidates_{};
+        UnallocatedSet<IndexData::MemoryPosition> shared_{};
+        std::size_t bytes_{};
+    };
+
+    // NOTE maximum number of index entries examined by one compaction pass
+    static constexpr auto max_scan_per_pass_ = std::size_t{65536};
+    static constexpr auto min_free_to_relocate_ = std::size_t{16_MiB};
 
     LMDB& lmdb_;
     const UnallocatedCString path_prefix_;
     const UnallocatedCString filename_prefix_;
     const int table_;
     const std::size_t key_;
+    const int free_table_;
     mutable IndexData::MemoryPosition next_position_;
     mutable UnallocatedVector<boost::iostreams::mapped_file> files_;
+    mutable FreeSpace free_;
+    const std::shared_ptr<FileStorageEpochs> epochs_;
+    // NOTE extents freed since the last compaction pass. The transactions
+    // which freed them may not have been committed.
+    mutable Extents pending_;
+    // NOTE committed releases, keyed by the epoch in which they were retired.
+    // They are moved to free_ once every reader from that epoch has finished.
+    mutable UnallocatedMap<std::uint64_t, Extents> retired_;
+    mutable std::size_t pending_bytes_;
+    mutable ScanState scan_;
+    // NOTE items located at or after generation_start_, or in space taken from
+    // a free extent at one of the positions in fresh_, were allocated since the
+    // current scan started and their contents may not have been written yet
+    mutable IndexData::MemoryPosition generation_start_;
+    mutable UnallocatedSet<IndexData::MemoryPosition> fresh_;
 
     auto calculate_file_name(
         const UnallocatedCString& prefix,
@@ -77,6 +355,171 @@ struct MappedFileStorage::Imp {
             create_or_load(path_prefix_, files_.size(), files_);
         }
     }
+    auto compact(
+        LMDB::Transaction& tx,
+        const IndexTables& tables,
+        std::size_t limit) noexcept -> std::size_t
+    {
+        // NOTE changes are made to copies of the in-memory state which replace
+        // the originals only if the transaction is committed successfully
+        auto free = free_;
+        auto retired = retired_;
+        auto released = Extents{};
+        auto scan = scan_;
+        auto next = next_position_;
+        auto moved = std::size_t{0};
+        const auto abort = [&] {
+            tx.Finalize(false);
+
+            return std::size_t{0};
+        };
+        const auto oldest = epochs_->Oldest();
+
+        for (auto i = retired.begin();
+             (retired.end() != i) && (i->first < oldest);
+             i = retired.erase(i)) {
+            for (const auto& [position, size] : i->second) {
+                if (false == free.Add(tx, position, size)) { return abort(); }
+            }
+        }
+
+        for (const auto& [position, size] : pending_) {
+            if (false == is_recorded(tx, position, size)) {
+                LogVerbose()(OT_PRETTY_CLASS())("discarding extent at ")(
+                    position)(" which was never committed")
+                    .Flush();
+
+                continue;
+            }
+
+            released.emplace(position, size);
+        }
+
+        auto complete = false;
+
+        if ((0u < limit) && (min_free_to_relocate_ <= free.Bytes())) {
+            try {
+                complete = find_candidates(
+                    tx, tables, free.First().value(), limit, scan);
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+                return abort();
+            }
+        }
+
+        if (complete) {
+            const auto items = std::move(scan.candidates_);
+            scan = {};
+
+            for (auto i = items.rbegin(); i != items.rend(); ++i) {
+                const auto& [table, key, value, from] = i->second;
+
+                if ((moved + from.size_) > limit) { continue; }
+
+                if (false == is_current(tx, i->second)) { continue; }
+
+                const auto target = free.Take(tx, from.size_, from.position_);
+
+                if (false == target.has_value()) { continue; }
+
+                auto to = IndexData{};
+                to.position_ = target.value();
+                to.size_ = from.size_;
+                const auto source = get_read_view(from);
+                const auto [file, offset] = get_offset(to.position_);
+                std::memcpy(
+                    files_.at(file).data() + offset,
+                    source.data(),
+                    source.size());
+                auto updated = value;
+                std::memcpy(updated.data(), &to, sizeof(to));
+
+                const auto index =
+                    lmdb_.Store(table, reader(key), reader(updated), tx);
+
+                if (false == index.first) {
+                    LogError()(OT_PRETTY_CLASS())("Failed to update index")
+                        .Flush();
+
+                    return abort();
+                }
+
+                const auto freed = lmdb_.Store(
+                    free_table_, from.position_, tsv(from.size_), tx);
+
+                if (false == freed.first) {
+                    LogError()(OT_PRETTY_CLASS())(
+                        "Failed to record free extent")
+                        .Flush();
+
+                    return abort();
+                }
+
+                released.emplace(from.position_, from.size_);
+                moved += from.size_;
+            }
+        }
+
+        for (auto start = free.TrimEnd(tx, next); start.has_value();
+             start = free.TrimEnd(tx, next)) {
+            next = start.value();
+        }
+
+        if (next != next_position_) {
+            const auto result = lmdb_.Store(table_, tsv(key_), tsv(next), tx);
+
+            if (false == result.first) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Failed to update next write position")
+                    .Flush();
+
+                return abort();
+            }
+        }
+
+        if (false == tx.Finalize(true)) {
+            LogError()(OT_PRETTY_CLASS())("Database error").Flush();
+
+            return 0;
+        }
+
+        LogVerbose()(OT_PRETTY_CLASS())("relocated ")(moved)(
+            " bytes and reclaimed ")(next_position_ - next)(
+            " bytes from the end of ")(filename_prefix_)(" files")
+            .Flush();
+        free_ = std::move(free);
+        retired_ = std::move(retired);
+        scan_ = std::move(scan);
+
+        if (false == released.empty()) {
+            // NOTE readers which start after this point load index entries
+            // which no longer refer to the released space
+            retired_.emplace(epochs_->Advance(), std::move(released));
+        }
+
+        pending_.clear();
+        pending_bytes_ = 0;
+
+        for (const auto& [epoch, extents] : retired_) {
+            for (const auto& [position, size] : extents) {
+                pending_bytes_ += size;
+            }
+        }
+
+        next_position_ = next;
+
+        if ((0u < scan_.table_) || (false == scan_.key_.empty())) {
+            // NOTE items allocated during an unfinished scan must remain
+            // excluded until the scan completes
+            generation_start_ = std::min(generation_start_, next_position_);
+        } else {
+            generation_start_ = next_position_;
+            fresh_.clear();
+        }
+
+        return moved;
+    }
     auto create_or_load(
         const UnallocatedCString& prefix,
         const FileCounter file,
@@ -119,6 +562,83 @@ struct MappedFileStorage::Imp {
             OT_FAIL;
         }
     }
+    // Examines at most max_scan_per_pass_ index entries, resuming at the
+    // position recorded in scan. Returns true once every index entry has been
+    // examined.
+    auto find_candidates(
+        LMDB::Transaction& tx,
+        const IndexTables& tables,
+        const IndexData::MemoryPosition lowest,
+        const std::size_t limit,
+        ScanState& scan) const noexcept(false) -> bool
+    {
+        auto& output = scan.candidates_;
+        auto& shared = scan.shared_;
+        auto& bytes = scan.bytes_;
+        auto visited = std::size_t{0};
+        const auto check = [&](auto table, auto key, auto value) {
+            auto index = IndexData{};
+
+            if (sizeof(index) > value.size()) { return; }
+
+            std::memcpy(&index, value.data(), sizeof(index));
+            const auto position = index.position_;
+
+            if ((0u == index.size_) || (lowest > position) ||
+                (generation_start_ <= position) ||
+                (next_position_ < (position + index.size_)) ||
+                (0u < fresh_.count(position))) {
+
+                return;
+            }
+
+            if (0u < shared.count(position)) { return; }
+
+            if (auto i = output.find(position); output.end() != i) {
+                // NOTE an item referenced by more than one index entry can not
+                // be relocated safely
+                bytes -= i->second.index_.size_;
+                output.erase(i);
+                shared.emplace(position);
+
+                return;
+            }
+
+            output.try_emplace(
+                position, Candidate{table, space(key), space(value), index});
+            bytes += index.size_;
+
+            // NOTE only the items closest to the end of the file are kept
+            while ((bytes > limit) && (1u < output.size())) {
+                bytes -= output.begin()->second.index_.size_;
+                output.erase(output.begin());
+            }
+        };
+
+        while (scan.table_ < tables.size()) {
+            const auto table = tables.at(scan.table_);
+            auto cursor = lmdb_.OpenCursor(table, tx);
+            auto found = scan.key_.empty() ? cursor.First()
+                                           : cursor.Seek(reader(scan.key_));
+
+            for (; found && (visited < max_scan_per_pass_);
+                 found = cursor.Next()) {
+                ++visited;
+                check(table, cursor.Key(), cursor.Value());
+            }
+
+            if (found) {
+                scan.key_ = space(cursor.Key());
+
+                return false;
+            }
+
+            scan.key_.clear();
+            ++scan.table_;
+        }
+
+        return true;
+    }
     auto get_read_view(const IndexData& index) noexcept -> ReadView
     {
         const auto [file, offset] = get_offset(index.position_);
@@ -134,7 +654,10 @@ struct MappedFileStorage::Imp {
     {
         if (0 == bytes) { return {}; }
 
-        const auto replace = bytes == index.size_;
+        // NOTE a stale index may refer to an item which has since been
+        // relocated by a compaction pass
+        const auto stale = is_released(index);
+        const auto replace = (bytes == index.size_) && (false == stale);
         const auto output = [&] {
             const auto [file, offset] = get_offset(index.position_);
             check_file(file);
@@ -144,24 +667,51 @@ struct MappedFileStorage::Imp {
 
         if (replace) {
             LogVerbose()(OT_PRETTY_CLASS())("Replacing existing item").Flush();
+            // NOTE the item must not be relocated before the caller has
+            // written the new contents
+            fresh_.emplace(index.position_);
 
             return output();
         }
 
-        increment_index(index, bytes);
-        LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
-            index.position_)
-            .Flush();
-        const auto nextPosition = index.position_ + bytes;
+        const auto previous = index;
+        const auto reused = free_.Take(tx, bytes);
+
+        if (reused.has_value()) {
+            index.size_ = bytes;
+            index.position_ = reused.value();
+            fresh_.emplace(index.position_);
+            LogDebug()(OT_PRETTY_CLASS())(
+                "Storing new item in free space at position ")(index.position_)
+                .Flush();
+        } else {
+            increment_index(index, bytes);
+            LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
+                index.position_)
+                .Flush();
+        }
 
         if (cb && (false == cb(tx))) { return {}; }
 
-        if (false == update_next_position(nextPosition, tx)) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Failed to update next write position")
-                .Flush();
+        if (false == reused.has_value()) {
+            if (index.position_ > next_position_) {
+                // NOTE the item did not fit in the remainder of the last file
+                free_.Add(tx, next_position_, index.position_ - next_position_);
+            }
 
-            return {};
+            const auto nextPosition = index.position_ + bytes;
+
+            if (false == update_next_position(nextPosition, tx)) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Failed to update next write position")
+                    .Flush();
+
+                return {};
+            }
+        }
+
+        if ((0u < previous.size_) && (false == stale)) {
+            release(tx, previous);
         }
 
         return output();
@@ -199,6 +749,81 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    // Returns true if the index entry from which a candidate was created is
+    // unchanged since the candidate was found
+    auto is_current(LMDB::Transaction& tx, const Candidate& item) const noexcept
+        -> bool
+    {
+        const auto& index = item.index_;
+
+        if ((0u < fresh_.count(index.position_)) || is_released(index) ||
+            (next_position_ < (index.position_ + index.size_))) {
+
+            return false;
+        }
+
+        auto output = false;
+        auto cb = [&](const auto in) { output = (reader(item.value_) == in); };
+        lmdb_.Load(item.table_, reader(item.key_), cb, tx);
+
+        return output;
+    }
+    auto is_recorded(
+        LMDB::Transaction& tx,
+        const IndexData::MemoryPosition position,
+        const IndexData::ItemSize size) const noexcept -> bool
+    {
+        auto output = false;
+        auto cb = [&](const auto in) {
+            auto recorded = IndexData::ItemSize{};
+
+            if (sizeof(recorded) != in.size()) { return; }
+
+            std::memcpy(&recorded, in.data(), in.size());
+            output = (recorded == size);
+        };
+        lmdb_.Load(free_table_, tsv(position), cb, tx);
+
+        return output;
+    }
+    auto is_released(const IndexData& index) const noexcept -> bool
+    {
+        if (0u == index.size_) { return false; }
+
+        if (0u < pending_.count(index.position_)) { return true; }
+
+        for (const auto& [epoch, extents] : retired_) {
+            if (0u < extents.count(index.position_)) { return true; }
+        }
+
+        return free_.Contains(index.position_);
+    }
+    auto load_free_space() noexcept -> FreeSpace
+    {
+        auto output = FreeSpace{lmdb_, free_table_};
+        auto cb = [&](const auto key, const auto value) {
+            auto position = IndexData::MemoryPosition{};
+            auto size = IndexData::ItemSize{};
+
+            if ((sizeof(position) != key.size()) ||
+                (sizeof(size) != value.size())) {
+
+                return true;
+            }
+
+            std::memcpy(&position, key.data(), key.size());
+            std::memcpy(&size, value.data(), value.size());
+
+            if ((0u < size) && ((position + size) <= next_position_)) {
+                output.Import(position, size);
+            }
+
+            return true;
+        };
+        lmdb_.Read(free_table_, cb, LMDB::Dir::Forward);
+
+        return output;
+    }
     auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
         -> IndexData::MemoryPosition
     {
@@ -220,6 +845,63 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto release(LMDB::Transaction& tx, const IndexData& index) noexcept
+        -> bool
+    {
+        if ((0u == index.size_) || is_released(index)) { return true; }
+
+        if ((index.position_ + index.size_) > next_position_) {
+            LogError()(OT_PRETTY_CLASS())("Invalid index").Flush();
+
+            return false;
+        }
+
+        const auto result =
+            lmdb_.Store(free_table_, index.position_, tsv(index.size_), tx);
+
+        if (false == result.first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to record free extent")
+                .Flush();
+
+            return false;
+        }
+
+        pending_.emplace(index.position_, index.size_);
+        pending_bytes_ += index.size_;
+
+        return true;
+    }
+    auto remove_unused_files() noexcept -> void
+    {
+        try {
+            for (auto file = files_.size();; ++file) {
+                const auto path = calculate_file_name(path_prefix_, file);
+
+                if (false == fs::exists(path)) { break; }
+
+                LogVerbose()(OT_PRETTY_CLASS())("removing unused file ")(path)
+                    .Flush();
+                fs::remove(path);
+            }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        }
+    }
+    auto start_read() const noexcept -> FileStorageReader
+    {
+        return FileStorageReader{epochs_};
+    }
+    auto stats() const noexcept -> FileStorageStats
+    {
+        auto output = FileStorageStats{};
+        output.free_bytes_ = free_.Bytes();
+        output.pending_bytes_ = pending_bytes_;
+        output.live_bytes_ =
+            next_position_ - (output.free_bytes_ + output.pending_bytes_);
+        output.file_bytes_ = files_.size() * mapped_file_size();
+
+        return output;
+    }
     auto update_next_position(
         IndexData::MemoryPosition position,
         LMDB::Transaction& tx) noexcept -> bool
@@ -242,14 +924,24 @@ struct MappedFileStorage::Imp {
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false)
+        std::size_t key,
+        int freeTable) noexcept(false)
         : lmdb_(lmdb)
         , path_prefix_(basePath)
         , filename_prefix_(filenamePrefix)
         , table_(table)
         , key_(key)
+        , free_table_(freeTable)
         , next_position_(load_position(lmdb_))
         , files_(init_files(path_prefix_, next_position_))
+        , free_(load_free_space())
+        , epochs_(std::make_shared<FileStorageEpochs>())
+        , pending_()
+        , retired_()
+        , pending_bytes_(0)
+        , scan_()
+        , generation_start_(next_position_)
+        , fresh_()
     {
         static_assert(1 == get_file_count(0));
         static_assert(1 == get_file_count(1));
@@ -275,6 +967,8 @@ struct MappedFileStorage::Imp {
 
             OT_ASSERT(files_.size() == (offset.first + 1));
         }
+
+        remove_unused_files();
     }
 };
 
@@ -283,14 +977,29 @@ MappedFileStorage::MappedFileStorage(
     const UnallocatedCString& basePath,
     const UnallocatedCString filenamePrefix,
     int table,
-    std::size_t key) noexcept(false)
+    std::size_t key,
+    int freeTable) noexcept(false)
     : lmdb_(lmdb)
-    , imp_p_(std::make_unique<Imp>(lmdb, basePath, filenamePrefix, table, key))
+    , imp_p_(std::make_unique<Imp>(
+          lmdb,
+          basePath,
+          filenamePrefix,
+          table,
+          key,
+          freeTable))
     , imp_(*imp_p_)
 {
     OT_ASSERT(imp_p_);
 }
 
+auto MappedFileStorage::compact(
+    LMDB::Transaction& tx,
+    const IndexTables& tables,
+    std::size_t limit) const noexcept -> std::size_t
+{
+    return imp_.compact(tx, tables, limit);
+}
+
 auto MappedFileStorage::get_read_view(const IndexData& index) const noexcept
     -> ReadView
 {
@@ -314,5 +1023,21 @@ auto MappedFileStorage::get_write_view(
     return imp_.get_write_view(tx, index, {}, size);
 }
 
+auto MappedFileStorage::release(LMDB::Transaction& tx, const IndexData& index)
+    const noexcept -> bool
+{
+    return imp_.release(tx, index);
+}
+
+auto MappedFileStorage::start_read() const noexcept -> FileStorageReader
+{
+    return imp_.start_read();
+}
+
+auto MappedFileStorage::stats() const noexcept -> FileStorageStats
+{
+    return imp_.stats();
+}
+
 MappedFileStorage::~MappedFileStorage() = default;
 }  // namespace opentxs::util
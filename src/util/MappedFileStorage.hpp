@@ -6,8 +6,12 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include "opentxs/Version.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -25,23 +29,119 @@ struct IndexData {
     ItemSize size_{};
 };
 
+struct FileStorageStats {
+    // Bytes occupied by items which are still referenced
+    std::size_t live_bytes_{};
+    // Bytes which have been freed and are available for new items
+    std::size_t free_bytes_{};
+    // Bytes which have been freed but will not be reused until a compaction
+    // pass finds that no reader can still hold a view into them
+    std::size_t pending_bytes_{};
+    // Total size of all backing files
+    std::size_t file_bytes_{};
+};
+
+// Free extents in the backing files, mirrored in an lmdb table keyed by
+// position. Adjacent extents are merged unless doing so would produce an extent
+// which crosses a file boundary, since no item may span two files.
+class FreeSpace
+{
+public:
+    using Position = IndexData::MemoryPosition;
+    using Size = IndexData::ItemSize;
+    using Extents = UnallocatedMap<Position, Size>;
+
+    auto Bytes() const noexcept -> std::size_t { return bytes_; }
+    auto Contains(const Position position) const noexcept -> bool;
+    auto First() const noexcept -> std::optional<Position>;
+    auto Get() const noexcept -> const Extents& { return extents_; }
+
+    auto Add(
+        storage::lmdb::LMDB::Transaction& tx,
+        Position position,
+        Size size) noexcept -> bool;
+    auto Import(const Position position, const Size size) noexcept -> void;
+    // Allocate space from the smallest extent which is large enough and which
+    // starts before the specified position
+    auto Take(
+        storage::lmdb::LMDB::Transaction& tx,
+        const Size size,
+        const Position before = std::numeric_limits<Position>::max()) noexcept
+        -> std::optional<Position>;
+    // Remove the extent which ends at the specified position, if any
+    auto TrimEnd(
+        storage::lmdb::LMDB::Transaction& tx,
+        const Position end) noexcept -> std::optional<Position>;
+
+    FreeSpace(const storage::lmdb::LMDB& lmdb, const int table) noexcept;
+    FreeSpace(const FreeSpace&) = default;
+    FreeSpace(FreeSpace&&) = default;
+    auto operator=(const FreeSpace&) -> FreeSpace& = default;
+    auto operator=(FreeSpace&&) -> FreeSpace& = default;
+
+    ~FreeSpace() = default;
+
+private:
+    const storage::lmdb::LMDB* lmdb_;
+    int table_;
+    Extents extents_;
+    UnallocatedSet<std::pair<Size, Position>> by_size_;
+    std::size_t bytes_;
+
+    auto erase(
+        storage::lmdb::LMDB::Transaction& tx,
+        Extents::iterator i) noexcept -> void;
+    auto insert(
+        storage::lmdb::LMDB::Transaction& tx,
+        const Position position,
+        const Size size) noexcept -> bool;
+};
+
+class FileStorageEpochs;
+
+// Prevents space which is released while it exists from being reused. Obtain
+// one before loading the index of an item and keep it until every view derived
+// from that index has been discarded.
+class FileStorageReader
+{
+public:
+    FileStorageReader(std::shared_ptr<FileStorageEpochs> epochs) noexcept;
+    FileStorageReader(FileStorageReader&& rhs) noexcept;
+
+    ~FileStorageReader();
+
+private:
+    std::shared_ptr<FileStorageEpochs> epochs_;
+    std::uint64_t epoch_;
+
+    FileStorageReader() = delete;
+    FileStorageReader(const FileStorageReader&) = delete;
+    auto operator=(const FileStorageReader&) -> FileStorageReader& = delete;
+    auto operator=(FileStorageReader&&) -> FileStorageReader& = delete;
+};
+
 class MappedFileStorage
 {
 protected:
     using LMDB = opentxs::storage::lmdb::LMDB;
     using UpdateCallback = std::function<bool(LMDB::Transaction&)>;
+    using IndexTables = UnallocatedVector<int>;
 
     LMDB& lmdb_;
 
     // NOTE: this class performs no locking. Inheritors must ensure these
-    // functions are not called simultaneously from multiple threads.
+    // functions are not called simultaneously from multiple threads, with the
+    // exception of start_read which may be called at any time.
     auto get_read_view(const IndexData& index) const noexcept -> ReadView;
     // Default construct an IndexData if you just want to append a new item, or
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
     // old items matches the size of the new item; to do otherwise would be
-    // madness. If the size doesn't match then space will be allocated at the
-    // end of the file and we just forget about the old data.
+    // madness. If the size doesn't match then new space will be allocated and
+    // the space occupied by the old item will be released.
+    //
+    // The existing IndexData must be loaded inside the supplied transaction,
+    // since a compaction pass may have moved the item since any earlier read.
     //
     // Regardless after this function is called the supplied index will be
     // updated to the location at which the return value points so you should
@@ -57,13 +157,38 @@ protected:
         LMDB::Transaction& tx,
         IndexData& index,
         std::size_t size) const noexcept -> WritableView;
+    // Relocate live items from the end of the backing files into free extents
+    // closer to the start, moving at most limit bytes, and reclaim any free
+    // space at the end of the files. Files which are no longer needed are
+    // deleted the next time the storage is opened.
+    //
+    // Released space becomes available for reuse once every reader which
+    // started before the release was committed has finished. Each pass
+    // examines a bounded number of index entries, resuming where the previous
+    // pass stopped, and items are only relocated by the pass which completes a
+    // scan of every table.
+    //
+    // Every value in the supplied tables must begin with an IndexData which
+    // refers to an item in this storage. The supplied transaction will be
+    // finalized by this function. Returns the number of bytes relocated.
+    auto compact(
+        LMDB::Transaction& tx,
+        const IndexTables& tables,
+        std::size_t limit) const noexcept -> std::size_t;
+    // Mark the space occupied by an item as free. Call this when deleting the
+    // index entry which refers to the item.
+    auto release(LMDB::Transaction& tx, const IndexData& index) const noexcept
+        -> bool;
+    auto start_read() const noexcept -> FileStorageReader;
+    auto stats() const noexcept -> FileStorageStats;
 
     MappedFileStorage(
         opentxs::storage::lmdb::LMDB& lmdb,
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false);
+        std::size_t key,
+        int freeTable) noexcept(false);
 
     virtual ~MappedFileStorage();
 
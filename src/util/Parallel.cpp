@@ -0,0 +1,101 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"       // IWYU pragma: associated
+#include "1_Internal.hpp"     // IWYU pragma: associated
+#include "util/Parallel.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "internal/api/network/Asio.hpp"
+#include "internal/util/Mutex.hpp"
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Session.hpp"
+
+namespace opentxs
+{
+auto RunParallel(
+    const api::Session& api,
+    const ThreadPool pool,
+    const std::size_t count,
+    std::function<void(std::size_t)> job) noexcept(false) -> void
+{
+    class State
+    {
+    public:
+        auto Run() noexcept -> void
+        {
+            for (auto i = next_++; i < count_; i = next_++) {
+                auto error = std::exception_ptr{};
+
+                try {
+                    job_(i);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+
+                auto lock = Lock{lock_};
+
+                if (error && (false == bool(error_))) { error_ = error; }
+
+                if (++finished_ == count_) { cv_.notify_all(); }
+            }
+        }
+        auto Wait() noexcept(false) -> void
+        {
+            auto lock = Lock{lock_};
+            cv_.wait(lock, [this] { return finished_ == count_; });
+
+            if (error_) { std::rethrow_exception(error_); }
+        }
+
+        State(
+            const std::size_t count,
+            std::function<void(std::size_t)>&& job) noexcept
+            : count_(count)
+            , job_(std::move(job))
+            , next_(0)
+            , lock_()
+            , cv_()
+            , finished_(0)
+            , error_()
+        {
+        }
+
+    private:
+        const std::size_t count_;
+        const std::function<void(std::size_t)> job_;
+        std::atomic<std::size_t> next_;
+        std::mutex lock_;
+        std::condition_variable cv_;
+        std::size_t finished_;
+        std::exception_ptr error_;
+    };
+
+    if (0u == count) { return; }
+
+    auto state = std::make_shared<State>(count, std::move(job));
+    const auto threads =
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 1u);
+    const auto helpers = std::min<std::size_t>(count, threads) - 1u;
+
+    for (auto n = std::size_t{0}; n < helpers; ++n) {
+        // NOTE a helper which starts after every job has been claimed does
+        // nothing, so the result of Post does not matter
+        api.Network().Asio().Internal().Post(pool, [state] { state->Run(); });
+    }
+
+    state->Run();
+    state->Wait();
+}
+}  // namespace opentxs
@@ -0,0 +1,37 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+class Session;
+}  // namespace api
+
+enum class ThreadPool;
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs
+{
+/// Calls job for every value in [0, count) using the calling thread plus any
+/// idle threads in the specified pool. The calling thread keeps claiming jobs
+/// until none remain so progress never depends on the pool. The first
+/// exception thrown by any job is rethrown once every job has finished.
+auto RunParallel(
+    const api::Session& api,
+    const ThreadPool pool,
+    const std::size_t count,
+    std::function<void(std::size_t)> job) noexcept(false) -> void;
+}  // namespace opentxs
@@ -0,0 +1,121 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <shared_mutex>
+
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs
+{
+/// Selects a shard using the leading bytes of an identifier. Identifiers are
+/// hashes so their leading bytes are already uniformly distributed.
+struct ShardByIdentifier {
+    auto operator()(const Data& id) const noexcept -> std::size_t
+    {
+        const auto bytes = id.Bytes();
+        auto out = std::size_t{0};
+        std::memcpy(&out, bytes.data(), std::min(sizeof(out), bytes.size()));
+
+        return out;
+    }
+};
+
+/// Lookup counters of a single shard
+struct ShardStatistics {
+    // Number of lookups which found the key already in the shard
+    std::uint64_t hits_{};
+    // Number of lookups which had to load or create the value
+    std::uint64_t misses_{};
+};
+
+using ShardedStatistics = UnallocatedVector<ShardStatistics>;
+
+/// A map which is split into a fixed number of independently locked shards so
+/// that operations on unrelated keys do not contend for the same mutex.
+///
+/// Callers obtain the shard which owns a key with get() and lock it
+/// themselves, which allows shared and exclusive access to be chosen per call
+/// site. Elements are never moved between shards so references to values
+/// remain valid for as long as the element is not erased.
+///
+/// Only the caller knows whether a lookup was served from the map, so call
+/// sites report each lookup with Shard::Hit() or Shard::Miss().
+template <
+    typename Key,
+    typename Value,
+    typename Hash,
+    typename Mutex = std::shared_mutex,
+    std::size_t Count = 16>
+class Sharded
+{
+public:
+    struct Shard {
+        mutable Mutex lock_{};
+        UnallocatedMap<Key, Value> map_{};
+
+        auto Hit() const noexcept -> void
+        {
+            hits_.fetch_add(1u, std::memory_order_relaxed);
+        }
+        auto Miss() const noexcept -> void
+        {
+            misses_.fetch_add(1u, std::memory_order_relaxed);
+        }
+        auto Stats() const noexcept -> ShardStatistics
+        {
+            auto output = ShardStatistics{};
+            output.hits_ = hits_.load(std::memory_order_relaxed);
+            output.misses_ = misses_.load(std::memory_order_relaxed);
+
+            return output;
+        }
+
+    private:
+        mutable std::atomic<std::uint64_t> hits_{0};
+        mutable std::atomic<std::uint64_t> misses_{0};
+    };
+
+    auto Stats() const noexcept -> ShardedStatistics
+    {
+        auto output = ShardedStatistics{};
+        output.reserve(Count);
+
+        for (const auto& shard : shards_) {
+            output.emplace_back(shard.Stats());
+        }
+
+        return output;
+    }
+    template <typename Lookup>
+    auto get(const Lookup& key) const noexcept -> Shard&
+    {
+        return shards_[Hash{}(key) % Count];
+    }
+
+    Sharded() noexcept
+        : shards_()
+    {
+    }
+
+    ~Sharded() = default;
+
+private:
+    mutable std::array<Shard, Count> shards_;
+
+    Sharded(const Sharded&) = delete;
+    Sharded(Sharded&&) = delete;
+    auto operator=(const Sharded&) -> Sharded& = delete;
+    auto operator=(Sharded&&) -> Sharded& = delete;
+};
+}  // namespace opentxs
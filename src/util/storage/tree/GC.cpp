@@ -7,16 +7,19 @@
 #include "1_Internal.hpp"              // IWYU pragma: associated
 #include "util/storage/tree/Root.hpp"  // IWYU pragma: associated
 
+#include <boost/system/error_code.hpp>  // IWYU pragma: keep
 #include <ctime>
+#include <memory>
 #include <utility>
 
 #include "internal/api/network/Asio.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/network/Asio.hpp"
+#include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/storage/Driver.hpp"
 #include "serialization/protobuf/StorageRoot.pb.h"
-#include "util/ScopeGuard.hpp"
 #include "util/storage/tree/Node.hpp"
 #include "util/storage/tree/Tree.hpp"
 
@@ -36,14 +39,17 @@ Root::GC::GC(
     , resume_(Flag::Factory(false))
     , root_(Node::BLANK_HASH)
     , last_(static_cast<std::int64_t>(std::time(nullptr)))
+    , step_(0)
+    , shutdown_(false)
+    , tree_()
+    , order_()
+    , timer_()
     , promise_()
     , future_(promise_.get_future())
 {
     promise_.set_value(true);
 }
 
-auto Root::GC::Cleanup() noexcept -> void { future_.get(); }
-
 auto Root::GC::Check(const UnallocatedCString root) noexcept -> CheckState
 {
     if (0 == interval_) {
@@ -78,6 +84,7 @@ auto Root::GC::Check(const UnallocatedCString root) noexcept -> CheckState
         if (intervalExceeded) {
             run();
             root_ = std::move(root);
+            step_.store(0);
 
             return CheckState::Start;
         } else {
@@ -87,16 +94,77 @@ auto Root::GC::Check(const UnallocatedCString root) noexcept -> CheckState
     }
 }
 
+auto Root::GC::Cleanup() noexcept -> void
+{
+    shutdown_.store(true);
+
+    {
+        auto lock = Lock{lock_};
+        timer_.Cancel();
+    }
+
+    future_.get();
+}
+
 auto Root::GC::collect_garbage(
     const bool from,
     const Driver* to,
     const SimpleCallback done) noexcept -> void
 {
-    LogVerbose()(OT_PRETTY_CLASS())("Beginning garbage collection.").Flush();
-    auto success{false};
-    auto postcondition = ScopeGuard{[&] { promise_.set_value(success); }};
-    auto temp = storage::Tree{factory_, driver_, root_};
-    success = temp.Migrate(*to);
+    OT_ASSERT(nullptr != to);
+    OT_ASSERT(done);
+
+    if (false == static_cast<bool>(tree_)) {
+        auto lock = Lock{lock_};
+        LogVerbose()(OT_PRETTY_CLASS())(
+            "Beginning garbage collection at step ")(step_.load())
+            .Flush();
+        tree_.reset(new storage::Tree{factory_, driver_, root_});
+        order_ = tree_->MigrationOrder();
+        timer_ = asio_.Internal().GetTimer();
+    }
+
+    OT_ASSERT(tree_);
+
+    const auto steps = tree_->MigrationSteps(order_);
+    const auto limit = Clock::now() + slice_;
+    auto step = step_.load();
+
+    // NOTE at least one step is executed per slice so a single large nym may
+    // exceed the time limit
+    while (step < steps) {
+        if (shutdown_.load()) {
+            suspend(done);
+
+            return;
+        }
+
+        if (false == tree_->MigrateStep(step, order_, *to)) {
+            finish(false, from, done);
+
+            return;
+        }
+
+        step_.store(++step);
+
+        if (Clock::now() >= limit) { break; }
+    }
+
+    if (step < steps) {
+        done();
+        schedule(from, to, done);
+    } else {
+        finish(true, from, done);
+    }
+}
+
+auto Root::GC::finish(
+    const bool success,
+    const bool from,
+    const SimpleCallback& done) noexcept -> void
+{
+    tree_.reset();
+    order_.clear();
 
     if (success) {
         driver_.EmptyBucket(from);
@@ -109,25 +177,27 @@ auto Root::GC::collect_garbage(
         running_->Off();
         resume_->Off();
         root_ = "";
+        step_.store(0);
         last_.store(std::time(nullptr));
     }
 
-    OT_ASSERT(done);
-
     done();
+    promise_.set_value(success);
     LogVerbose()(OT_PRETTY_CLASS())("Finished garbage collection.").Flush();
 }
 
 auto Root::GC::Init(
     const UnallocatedCString& root,
     bool resume,
-    std::uint64_t last) noexcept -> void
+    std::uint64_t last,
+    std::uint64_t step) noexcept -> void
 {
     auto lock = Lock{lock_};
     root_ = root;
     running_->Off();
     resume_->Set(resume);
     last_.store(last);
+    step_.store(step);
 }
 
 auto Root::GC::Run(
@@ -142,12 +212,54 @@ auto Root::GC::Run(
     return true;
 }
 
+auto Root::GC::schedule(
+    const bool from,
+    const Driver* to,
+    const SimpleCallback done) noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    if (shutdown_.load()) {
+        lock.unlock();
+        suspend(done);
+
+        return;
+    }
+
+    timer_.SetRelative(pause_);
+    timer_.Wait([=](const auto& ec) {
+        if (ec) {
+            suspend(done);
+        } else {
+            const auto queued = asio_.Internal().Post(
+                ThreadPool::General,
+                [=] { collect_garbage(from, to, done); });
+
+            if (false == queued) { suspend(done); }
+        }
+    });
+}
+
 auto Root::GC::Serialize(proto::StorageRoot& out) const noexcept -> void
 {
     auto lock = Lock{lock_};
     out.set_lastgc(last_.load());
     out.set_gc(running_.get());
     out.set_gcroot(root_);
+    out.set_gcstep(step_.load());
+}
+
+auto Root::GC::suspend(const SimpleCallback& done) noexcept -> void
+{
+    // NOTE running_ stays set so the saved root records that collection must
+    // resume from step_ the next time the session starts
+    tree_.reset();
+    order_.clear();
+    done();
+    promise_.set_value(false);
+    LogVerbose()(OT_PRETTY_CLASS())("Garbage collection suspended at step ")(
+        step_.load())
+        .Flush();
 }
 
 Root::GC::~GC() { Cleanup(); }
@@ -73,9 +73,9 @@ void Root::init(const UnallocatedCString& hash)
     tree_root_ = normalize_hash(data->items());
 
     if (auto root = normalize_hash(data->gcroot()); Node::check_hash(root)) {
-        gc_.Init(root, data->gc(), data->lastgc());
+        gc_.Init(root, data->gc(), data->lastgc(), data->gcstep());
     } else {
-        gc_.Init({}, false, data->lastgc());
+        gc_.Init({}, false, data->lastgc(), 0u);
     }
 }
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <future>
 #include <limits>
@@ -17,6 +18,7 @@
 #include "internal/util/Editor.hpp"
 #include "internal/util/Flag.hpp"
 #include "internal/util/Mutex.hpp"
+#include "internal/util/Timer.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
 #include "opentxs/util/Types.hpp"
@@ -79,13 +81,8 @@ public:
     auto Save(const Driver& to) const -> bool;
     auto Sequence() const -> std::uint64_t;
 
-    ~Root() final = default;
-
-private:
-    using ot_super = Node;
-    friend opentxs::storage::driver::Multiplex;
-    friend api::session::imp::Storage;
-
+    /// Copies the reachable tree to the other bucket in resumable time
+    /// slices
     class GC
     {
     public:
@@ -102,8 +99,11 @@ private:
         auto Init(
             const UnallocatedCString& root,
             bool resume,
-            std::uint64_t last) noexcept -> void;
+            std::uint64_t last,
+            std::uint64_t step) noexcept -> void;
         auto Resume(bool fromBucket) noexcept -> bool;
+        /// cb saves the root object and is called after every time slice as
+        /// well as after the collection finishes
         auto Run(const bool from, const Driver& to, SimpleCallback cb) noexcept
             -> bool;
         auto Start(bool fromBucket) noexcept -> bool;
@@ -117,6 +117,12 @@ private:
         ~GC();
 
     private:
+        // NOTE each job migrates tree steps for at most slice_ and is followed
+        // by an idle period of the same length so that foreground storage
+        // operations are never starved of disk bandwidth
+        static constexpr auto slice_ = std::chrono::milliseconds{100};
+        static constexpr auto pause_ = std::chrono::milliseconds{100};
+
         const api::network::Asio& asio_;
         const api::session::Factory& factory_;
         const Driver& driver_;
@@ -126,6 +132,13 @@ private:
         OTFlag resume_;
         UnallocatedCString root_;
         std::atomic<std::uint64_t> last_;
+        std::atomic<std::uint64_t> step_;
+        std::atomic_bool shutdown_;
+        std::unique_ptr<storage::Tree> tree_;
+        // NOTE captured when tree_ is loaded so each step can find its nym
+        // without walking the nym list
+        storage::Tree::MigrationNyms order_;
+        Timer timer_;
         std::promise<bool> promise_;
         std::shared_future<bool> future_;
 
@@ -133,8 +146,24 @@ private:
             const bool from,
             const Driver* to,
             const SimpleCallback done) noexcept -> void;
+        auto finish(
+            const bool success,
+            const bool from,
+            const SimpleCallback& done) noexcept -> void;
+        auto schedule(
+            const bool from,
+            const Driver* to,
+            const SimpleCallback done) noexcept -> void;
+        auto suspend(const SimpleCallback& done) noexcept -> void;
     };
 
+    ~Root() final = default;
+
+private:
+    using ot_super = Node;
+    friend opentxs::storage::driver::Multiplex;
+    friend api::session::imp::Storage;
+
     static constexpr auto current_version_ = VersionNumber{2};
 
     const api::session::Factory& factory_;
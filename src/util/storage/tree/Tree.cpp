@@ -7,7 +7,9 @@
 #include "1_Internal.hpp"              // IWYU pragma: associated
 #include "util/storage/tree/Tree.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
 #include <stdexcept>
 
 #include "Proto.hpp"
@@ -238,19 +240,87 @@ auto Tree::Load(std::shared_ptr<proto::Ciphertext>& output, const bool checking)
 auto Tree::Migrate(const Driver& to) const -> bool
 {
     bool output{true};
-    output &= accounts()->Migrate(to);
-    output &= contacts()->Migrate(to);
-    output &= credentials()->Migrate(to);
-    output &= notary("")->Migrate(to);
-    output &= nyms()->Migrate(to);
-    output &= seeds()->Migrate(to);
-    output &= servers()->Migrate(to);
-    output &= units()->Migrate(to);
-    output &= migrate(root_, to);
+    const auto order = MigrationOrder();
+
+    for (auto step = std::size_t{0}, steps = MigrationSteps(order);
+         step < steps;
+         ++step) {
+        output &= MigrateStep(step, order, to);
+    }
+
+    return output;
+}
+
+auto Tree::MigrateStep(
+    const std::size_t step,
+    const MigrationNyms& order,
+    const Driver& to) const -> bool
+{
+    switch (step) {
+        case 0: {
+            return accounts()->Migrate(to);
+        }
+        case 1: {
+            return contacts()->Migrate(to);
+        }
+        case 2: {
+            return credentials()->Migrate(to);
+        }
+        case 3: {
+            return notary("")->Migrate(to);
+        }
+        case 4: {
+            return seeds()->Migrate(to);
+        }
+        case 5: {
+            return servers()->Migrate(to);
+        }
+        case 6: {
+            return units()->Migrate(to);
+        }
+        default: {
+        } break;
+    }
+
+    // NOTE the nyms subtree holds most of the data so every nym is migrated
+    // as a separate step
+    const auto* list = nyms();
+    const auto index = step - fixed_migration_steps_;
+
+    if (index < order.size()) {
+
+        return list->nym(order[index])->Migrate(to);
+    } else if (index == order.size()) {
+        auto output = list->migrate(list->root_, to);
+        output &= migrate(root_, to);
+
+        return output;
+    } else {
+        LogError()(OT_PRETTY_CLASS())("Invalid step ")(step).Flush();
+
+        return false;
+    }
+}
+
+auto Tree::MigrationOrder() const -> MigrationNyms
+{
+    auto output = MigrationNyms{};
+    const auto list = nyms()->List();
+    output.reserve(list.size());
+    std::transform(
+        list.begin(),
+        list.end(),
+        std::back_inserter(output),
+        [](const auto& item) { return item.first; });
 
     return output;
 }
 
+auto Tree::MigrationSteps(const MigrationNyms& order) const -> std::size_t
+{
+    return fixed_migration_steps_ + order.size() + 1u;
+}
+
 auto Tree::mutable_Accounts() -> Editor<storage::Accounts>
 {
     return get_editor<storage::Accounts>(
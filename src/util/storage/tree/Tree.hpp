@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -84,7 +85,20 @@ public:
     auto Load(
         std::shared_ptr<proto::Ciphertext>& output,
         const bool checking = false) const -> bool;
+    using MigrationNyms = UnallocatedVector<UnallocatedCString>;
+
     auto Migrate(const Driver& to) const -> bool final;
+    /// Copies one independent part of the tree. Steps may be executed in
+    /// separate jobs and must all succeed for the tree to be fully migrated.
+    /// order is the list returned by MigrationOrder.
+    auto MigrateStep(
+        const std::size_t step,
+        const MigrationNyms& order,
+        const Driver& to) const -> bool;
+    /// The nyms in the order their steps are executed. The order and the
+    /// number of steps are stable for a given root hash.
+    auto MigrationOrder() const -> MigrationNyms;
+    auto MigrationSteps(const MigrationNyms& order) const -> std::size_t;
 
     auto Store(const proto::Ciphertext& serialized) -> bool;
 
@@ -94,6 +108,8 @@ private:
     friend api::imp::Storage;
     friend storage::Root;
 
+    static constexpr auto fixed_migration_steps_ = std::size_t{7};
+
     const api::session::Factory& factory_;
 
     UnallocatedCString account_root_{Node::BLANK_HASH};
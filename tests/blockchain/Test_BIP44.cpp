@@ -200,5 +200,41 @@ TEST_F(Test_BIP44, balance_elements)
     }
 }
 
+TEST_F(Test_BIP44, public_lookahead)
+{
+    // Elements are generated in lookahead batches derived from the public
+    // subchain key. They must match the keys derived from the private account
+    // key.
+    const auto root = account_.RootNode(reason_);
+
+    ASSERT_TRUE(root);
+
+    const auto test = [&](auto subchain, auto change) {
+        const auto last = account_.LastGenerated(subchain);
+
+        ASSERT_TRUE(last.has_value());
+        ASSERT_GE(last.value() + 1u, count_);
+
+        const auto parent = root->ChildKey(change, reason_);
+
+        ASSERT_TRUE(parent);
+
+        for (auto i{0u}; i <= last.value(); ++i) {
+            const auto pPublic = account_.Key(subchain, i);
+            const auto pPrivate = parent->ChildKey(i, reason_);
+
+            ASSERT_TRUE(pPublic);
+            ASSERT_TRUE(pPrivate);
+            EXPECT_EQ(
+                api_.Factory().DataFromBytes(pPublic->PublicKey())->asHex(),
+                api_.Factory().DataFromBytes(pPrivate->PublicKey())->asHex());
+        }
+    };
+    using Subchain = ot::blockchain::crypto::Subchain;
+
+    test(Subchain::External, 0u);
+    test(Subchain::Internal, 1u);
+}
+
 TEST_F(Test_BIP44, shutdown) { const_cast<ot::Nym_p&>(nym_).reset(); }
 }  // namespace ottest
@@ -13,6 +13,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "1_Internal.hpp"
@@ -461,6 +462,61 @@ TEST_F(Test_BitcoinBlock, serialization)
     }
 }
 
+TEST_F(Test_BitcoinBlock, transaction_access)
+{
+    for (const auto& vector : bip_158_vectors_) {
+        const auto raw = vector.Block(api_);
+        const auto pBlock = api_.Factory().BitcoinBlock(
+            ot::blockchain::Type::Bitcoin_testnet3, raw->Bytes());
+
+        ASSERT_TRUE(pBlock);
+
+        const auto& block = *pBlock;
+
+        for (auto i = std::size_t{0}; i < block.size(); ++i) {
+            const auto pTx = block.at(i);
+
+            ASSERT_TRUE(pTx);
+
+            const auto& txid = pTx->ID();
+            const auto pSame = block.at(txid.Bytes());
+
+            ASSERT_TRUE(pSame);
+            EXPECT_EQ(pTx.get(), pSame.get());
+            EXPECT_EQ(pSame->ID(), txid);
+        }
+    }
+}
+
+TEST_F(Test_BitcoinBlock, malformed_transaction)
+{
+    constexpr auto chain = ot::blockchain::Type::Bitcoin;
+    const auto& genesisHex =
+        genesis_block_data_.at(chain).genesis_block_hex_;
+    const auto parse = [&](const auto& hex) {
+        const auto bytes = api_.Factory().DataFromHex(hex);
+
+        return api_.Factory().BitcoinBlock(chain, bytes->Bytes());
+    };
+
+    ASSERT_TRUE(parse(genesisHex));
+
+    // NOTE the output count of the coinbase transaction follows the 80 byte
+    // header, the transaction count, and the single coinbase input
+    constexpr auto outputCount = std::size_t{2 * 204};
+    auto extraOutput = genesisHex;
+
+    ASSERT_EQ(extraOutput.substr(outputCount, 2), "01");
+
+    extraOutput.replace(outputCount, 2, "02");
+
+    EXPECT_FALSE(parse(extraOutput));
+
+    const auto truncated = genesisHex.substr(0, genesisHex.size() - 2u);
+
+    EXPECT_FALSE(parse(truncated));
+}
+
 TEST_F(Test_BitcoinBlock, bch_filter_1307544)
 {
     const auto& filter = bch_filter_1307544_;
@@ -10,6 +10,8 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iterator>
+#include <random>
+#include <stdexcept>
 #include <string_view>
 #include <utility>
 
@@ -340,6 +342,79 @@ TEST_F(Test_Filters, golomb_coding)
     }
 }
 
+TEST_F(Test_Filters, golomb_match)
+{
+    const auto elements = ot::Vector<std::uint64_t>{2, 3, 5, 8, 13};
+    const auto targets = ot::Vector<std::uint64_t>{1, 3, 8, 14};
+    const auto N = static_cast<std::uint32_t>(elements.size());
+    const auto P = std::uint8_t{19};
+    const auto encoded = ot::gcs::GolombEncode(P, elements, {});
+    const auto matches = ot::gcs::GolombMatch(N, P, encoded, targets, {});
+
+    ASSERT_EQ(matches.size(), 2u);
+    EXPECT_EQ(matches.at(0), 3u);
+    EXPECT_EQ(matches.at(1), 8u);
+}
+
+TEST_F(Test_Filters, golomb_truncated)
+{
+    const auto elements = ot::Vector<std::uint64_t>{2, 3, 5, 8, 13};
+    const auto N = static_cast<std::uint32_t>(elements.size());
+    const auto P = std::uint8_t{19};
+    auto encoded = ot::gcs::GolombEncode(P, elements, {});
+
+    EXPECT_EQ(ot::gcs::GolombDecode(N, P, encoded, {}), elements);
+
+    encoded.pop_back();
+
+    EXPECT_THROW(ot::gcs::GolombDecode(N, P, encoded, {}), std::out_of_range);
+    EXPECT_THROW(
+        ot::gcs::GolombMatch(N, P, encoded, {13}, {}), std::out_of_range);
+
+    encoded.clear();
+
+    EXPECT_THROW(ot::gcs::GolombDecode(N, P, encoded, {}), std::out_of_range);
+}
+
+TEST_F(Test_Filters, siphash_batch)
+{
+    const auto key = ot::UnallocatedCString{"0123456789abcdef"};
+    auto data = ot::UnallocatedVector<ot::UnallocatedCString>{};
+    auto rng = std::mt19937{42u};
+    auto byte = std::uniform_int_distribution<int>{0, 255};
+
+    // NOTE runs of four equal length items exercise the multi-lane path and
+    // the remainder exercises the single item path
+    for (auto size = std::size_t{0}; size < 70u; ++size) {
+        const auto count = (0u == size % 3u) ? 4u : 1u;
+
+        for (auto n = 0u; n < count; ++n) {
+            auto& item = data.emplace_back(size, '\0');
+
+            for (auto i = std::size_t{0}; i < size; ++i) {
+                item[i] = static_cast<char>(byte(rng));
+            }
+        }
+    }
+
+    const auto targets = [&] {
+        auto out = ot::blockchain::GCS::Targets{};
+        std::transform(
+            data.begin(), data.end(), std::back_inserter(out), [](auto& i) {
+                return ot::ReadView{i};
+            });
+
+        return out;
+    }();
+    const auto hashes = ot::gcs::SiphashBatch(key, targets, {});
+
+    ASSERT_EQ(hashes.size(), targets.size());
+
+    for (auto i = std::size_t{0}; i < targets.size(); ++i) {
+        EXPECT_EQ(hashes.at(i), ot::gcs::Siphash(api_, key, targets.at(i)));
+    }
+}
+
 TEST_F(Test_Filters, gcs)
 {
     const auto s1 = ot::UnallocatedCString{"blah"};
@@ -386,6 +461,98 @@ TEST_F(Test_Filters, gcs)
     }
 }
 
+TEST_F(Test_Filters, gcs_batch_match)
+{
+    const auto s1 = ot::UnallocatedCString{"blah"};
+    const auto s2 = ot::UnallocatedCString{"foo"};
+    const auto s3 = ot::UnallocatedCString{"justus"};
+    const auto s4 = ot::UnallocatedCString{"fellowtraveler"};
+    const auto s5 = ot::UnallocatedCString{"islajames"};
+    const auto s6 = ot::UnallocatedCString{"timewaitsfornoman"};
+    const auto object1(ot::Data::Factory(s1.data(), s1.length()));
+    const auto object2(ot::Data::Factory(s2.data(), s2.length()));
+    const auto object3(ot::Data::Factory(s3.data(), s3.length()));
+    const auto object4(ot::Data::Factory(s4.data(), s4.length()));
+    const auto object5(ot::Data::Factory(s5.data(), s5.length()));
+    const auto object6(ot::Data::Factory(s6.data(), s6.length()));
+    const auto includedElements =
+        ot::Vector<ot::OTData>{object1, object2, object3, object4};
+    const auto key = ot::UnallocatedCString{"0123456789abcdef"};
+    const auto original = ot::factory::GCS(
+        api_, params_.first, params_.second, key, includedElements, {});
+
+    ASSERT_TRUE(original.IsValid());
+
+    auto compressed = ot::Space{};
+
+    ASSERT_TRUE(original.Compressed(ot::writer(compressed)));
+
+    // NOTE constructed from the encoded form so that matching must decode it
+    const auto gcs = ot::factory::GCS(
+        api_,
+        params_.first,
+        params_.second,
+        key,
+        original.ElementCount(),
+        ot::reader(compressed),
+        {});
+
+    ASSERT_TRUE(gcs.IsValid());
+
+    const auto prehash = [&](const auto& objects) {
+        auto out = ot::gcs::Hashes{};
+
+        for (const auto& object : objects) {
+            out.emplace_back(ot::gcs::Siphash(api_, key, object->Bytes()));
+        }
+
+        return out;
+    };
+    const auto setA = prehash(ot::Vector<ot::OTData>{object5, object1});
+    const auto setB =
+        prehash(ot::Vector<ot::OTData>{object3, object6, object4});
+    const auto setC = prehash(ot::Vector<ot::OTData>{object6});
+    const auto targets =
+        ot::blockchain::internal::GCS::PrehashedTargets{&setA, &setB, &setC};
+    const auto result = gcs.Internal().Match(targets);
+
+    ASSERT_TRUE(result.has_value());
+
+    const auto& matches = result.value();
+
+    ASSERT_EQ(matches.size(), 3u);
+    ASSERT_EQ(matches.at(0).size(), 1u);
+    ASSERT_EQ(matches.at(1).size(), 2u);
+    EXPECT_EQ(matches.at(2).size(), 0u);
+    EXPECT_EQ(matches.at(0).at(0), std::next(setA.cbegin(), 1));
+    EXPECT_EQ(matches.at(1).at(0), std::next(setB.cbegin(), 0));
+    EXPECT_EQ(matches.at(1).at(1), std::next(setB.cbegin(), 2));
+
+    for (auto n = std::size_t{0}; n < 3u; ++n) {
+        const auto& set = (0u == n) ? setA : ((1u == n) ? setB : setC);
+        const auto single = gcs.Internal().Match(set);
+
+        EXPECT_EQ(single.size(), matches.at(n).size());
+    }
+
+    compressed.pop_back();
+    const auto truncated = ot::factory::GCS(
+        api_,
+        params_.first,
+        params_.second,
+        key,
+        original.ElementCount(),
+        ot::reader(compressed),
+        {});
+
+    ASSERT_TRUE(truncated.IsValid());
+
+    // NOTE a failure to decode is reported every time instead of being cached
+    // as an empty set
+    EXPECT_FALSE(truncated.Internal().Match(targets).has_value());
+    EXPECT_FALSE(truncated.Internal().Match(targets).has_value());
+}
+
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
 
 TEST_F(Test_Filters, bip158_case_49291) { EXPECT_TRUE(TestGCSBlock(49291)); }
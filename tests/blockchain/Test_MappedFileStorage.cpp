@@ -0,0 +1,274 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+#include <lmdb.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "internal/util/TSV.hpp"
+#include "ottest/Basic.hpp"
+#include "util/ByteLiterals.hpp"
+#include "util/FileSize.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace ot = opentxs;
+namespace fs = boost::filesystem;
+
+namespace ottest
+{
+enum StorageTable : int {
+    Config = 0,
+    Index = 1,
+    Free = 2,
+};
+
+class FileStorage final : public ot::util::MappedFileStorage
+{
+public:
+    using MappedFileStorage::compact;
+    using MappedFileStorage::get_read_view;
+    using MappedFileStorage::get_write_view;
+    using MappedFileStorage::release;
+    using MappedFileStorage::start_read;
+    using MappedFileStorage::stats;
+
+    FileStorage(
+        ot::storage::lmdb::LMDB& lmdb,
+        const ot::UnallocatedCString& path) noexcept(false)
+        : MappedFileStorage(lmdb, path, "test", Config, 0, Free)
+    {
+    }
+
+    ~FileStorage() final = default;
+};
+
+class Test_MappedFileStorage : public ::testing::Test
+{
+public:
+    using IndexData = ot::util::IndexData;
+
+    const ot::UnallocatedCString folder_;
+    ot::storage::lmdb::LMDB lmdb_;
+    FileStorage storage_;
+
+    auto compact(const std::size_t limit) -> std::size_t
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        return storage_.compact(tx, {Index}, limit);
+    }
+    auto load(const std::string& key) -> IndexData
+    {
+        auto out = IndexData{};
+        auto cb = [&out](const auto in) {
+            if (sizeof(out) != in.size()) { return; }
+
+            std::memcpy(&out, in.data(), in.size());
+        };
+        lmdb_.Load(Index, key, cb);
+
+        return out;
+    }
+    auto remove(const std::string& key) -> void
+    {
+        const auto index = load(key);
+        auto tx = lmdb_.TransactionRW();
+
+        EXPECT_TRUE(storage_.release(tx, index));
+        EXPECT_TRUE(lmdb_.Delete(Index, key, tx));
+        EXPECT_TRUE(tx.Finalize(true));
+    }
+    auto store(
+        const std::string& key,
+        const std::size_t size,
+        const char fill) -> IndexData
+    {
+        auto tx = lmdb_.TransactionRW();
+        auto index = load(key);
+        auto view = storage_.get_write_view(tx, index, size);
+
+        EXPECT_TRUE(view.valid(size));
+
+        std::memset(view.data(), fill, size);
+
+        EXPECT_TRUE(lmdb_.Store(Index, key, ot::tsv(index), tx).first);
+        EXPECT_TRUE(tx.Finalize(true));
+
+        return index;
+    }
+    auto verify(const std::string& key, const char fill) -> bool
+    {
+        const auto view = storage_.get_read_view(load(key));
+
+        if (0u == view.size()) { return false; }
+
+        for (const auto c : view) {
+            if (fill != c) { return false; }
+        }
+
+        return true;
+    }
+
+    Test_MappedFileStorage()
+        : folder_([] {
+            const auto path =
+                fs::path{Home()} / fs::unique_path("mappedfilestorage-%%%%");
+            fs::create_directories(path);
+
+            return path.string();
+        }())
+        , lmdb_(
+              {
+                  {Config, "config"},
+                  {Index, "index"},
+                  {Free, "free"},
+              },
+              folder_,
+              {
+                  {Config, MDB_INTEGERKEY},
+                  {Index, 0},
+                  {Free, MDB_INTEGERKEY},
+              })
+        , storage_(lmdb_, folder_)
+    {
+    }
+};
+
+TEST_F(Test_MappedFileStorage, free_space)
+{
+    const auto boundary = ot::mapped_file_size();
+    auto free = ot::util::FreeSpace{lmdb_, Free};
+
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        EXPECT_TRUE(free.Add(tx, 0, 10));
+        EXPECT_TRUE(free.Add(tx, 20, 10));
+        EXPECT_TRUE(free.Add(tx, 10, 10));
+        EXPECT_TRUE(free.Add(tx, 40, 5));
+        EXPECT_TRUE(free.Add(tx, boundary - 10, 10));
+        EXPECT_TRUE(free.Add(tx, boundary, 10));
+        EXPECT_TRUE(tx.Finalize(true));
+    }
+
+    // Adjacent extents are merged unless they are in different files
+    const auto expected = ot::util::FreeSpace::Extents{
+        {0, 30},
+        {40, 5},
+        {boundary - 10, 10},
+        {boundary, 10},
+    };
+
+    EXPECT_EQ(free.Get(), expected);
+    EXPECT_EQ(free.Bytes(), 55u);
+    EXPECT_TRUE(free.Contains(29));
+    EXPECT_FALSE(free.Contains(30));
+    EXPECT_EQ(free.First(), 0u);
+    EXPECT_FALSE(lmdb_.Exists(Free, ot::tsv(std::size_t{10})));
+    EXPECT_FALSE(lmdb_.Exists(Free, ot::tsv(std::size_t{20})));
+    EXPECT_TRUE(lmdb_.Exists(Free, ot::tsv(std::size_t{0})));
+
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        // The smallest sufficient extent is used first and is split if it is
+        // larger than the request
+        EXPECT_EQ(free.Take(tx, 5), 40u);
+        EXPECT_EQ(free.Take(tx, 4), boundary - 10);
+        EXPECT_EQ(free.Take(tx, 8, boundary), 0u);
+        EXPECT_EQ(free.Take(tx, 30, boundary), std::nullopt);
+        EXPECT_EQ(free.Take(tx, 10, 8), std::nullopt);
+        EXPECT_EQ(free.TrimEnd(tx, boundary), std::nullopt);
+        EXPECT_EQ(free.TrimEnd(tx, boundary + 10), boundary);
+        EXPECT_TRUE(tx.Finalize(true));
+    }
+
+    const auto remaining = ot::util::FreeSpace::Extents{
+        {8, 22},
+        {boundary - 6, 6},
+    };
+
+    EXPECT_EQ(free.Get(), remaining);
+    EXPECT_EQ(free.Bytes(), 28u);
+}
+
+TEST_F(Test_MappedFileStorage, reuse_after_readers_finish)
+{
+    const auto first = store("first", 100, 'a');
+    auto reader = std::make_optional(storage_.start_read());
+    remove("first");
+
+    EXPECT_EQ(compact(0), 0u);
+    EXPECT_EQ(compact(0), 0u);
+    EXPECT_EQ(storage_.stats().free_bytes_, 0u);
+    EXPECT_EQ(storage_.stats().pending_bytes_, 100u);
+
+    // A reader which started before the release may still hold a view into
+    // the released space
+    const auto second = store("second", 100, 'b');
+
+    EXPECT_NE(second.position_, first.position_);
+
+    const auto later = storage_.start_read();
+    reader.reset();
+
+    EXPECT_EQ(compact(0), 0u);
+    EXPECT_EQ(storage_.stats().free_bytes_, 100u);
+    EXPECT_EQ(storage_.stats().pending_bytes_, 0u);
+
+    const auto third = store("third", 100, 'c');
+
+    EXPECT_EQ(third.position_, first.position_);
+    EXPECT_TRUE(verify("second", 'b'));
+    EXPECT_TRUE(verify("third", 'c'));
+}
+
+TEST_F(Test_MappedFileStorage, relocate)
+{
+    constexpr auto size = std::size_t{1_MiB};
+    constexpr auto count = 20;
+    const auto key = [](const int i) { return "item-" + std::to_string(i); };
+
+    for (auto i = 0; i < count; ++i) {
+        store(key(i), size, static_cast<char>(i));
+    }
+
+    const auto last = store("last", size, 'z');
+
+    for (auto i = 0; i < (count - 2); ++i) { remove(key(i)); }
+
+    // The first pass retires the released space and the second makes it
+    // available for relocation
+    EXPECT_EQ(compact(size), 0u);
+    EXPECT_EQ(compact(size), size);
+
+    const auto moved = load("last");
+
+    EXPECT_EQ(moved.size_, size);
+    EXPECT_LT(moved.position_, last.position_);
+    EXPECT_EQ(moved.position_, 0u);
+    EXPECT_TRUE(verify("last", 'z'));
+    EXPECT_TRUE(verify(key(count - 2), static_cast<char>(count - 2)));
+    EXPECT_TRUE(verify(key(count - 1), static_cast<char>(count - 1)));
+    EXPECT_EQ(storage_.stats().pending_bytes_, size);
+
+    // The space vacated by the relocated item is reclaimed from the end of
+    // the file once it is no longer pending
+    EXPECT_EQ(compact(0), 0u);
+
+    const auto stats = storage_.stats();
+
+    EXPECT_EQ(stats.pending_bytes_, 0u);
+    EXPECT_EQ(stats.free_bytes_, (count - 3) * size);
+    EXPECT_EQ(stats.live_bytes_, 3u * size);
+}
+}  // namespace ottest
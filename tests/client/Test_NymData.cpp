@@ -12,6 +12,7 @@
 #include <tuple>
 
 #include "1_Internal.hpp"
+#include "internal/api/session/Wallet.hpp"
 #include "internal/identity/wot/claim/Types.hpp"
 #include "internal/serialization/protobuf/Contact.hpp"
 
@@ -213,6 +214,40 @@ TEST_F(Test_NymData, BestSocialMediaProfile)
     EXPECT_STREQ("profile1", profile.c_str());
 }
 
+TEST_F(Test_NymData, CachedNym)
+{
+    const auto& wallet = client_.Wallet().Internal();
+    const auto& id = nymData_.Nym().ID();
+    const auto hits = [&] {
+        auto output = std::uint64_t{0};
+
+        for (const auto& shard : wallet.NymCacheStatistics()) {
+            output += shard.hits_;
+        }
+
+        return output;
+    };
+    const auto before = hits();
+    const auto first = wallet.Nym(id);
+    const auto second = wallet.Nym(id);
+
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first.get(), &nymData_.Nym());
+    EXPECT_GE(hits(), before + 2u);
+
+    EXPECT_TRUE(nymData_.AddEmail("cached@example.com", true, true, reason_));
+
+    nymData_.Release();
+    const auto edited = wallet.Nym(id);
+
+    // The edited nym is still valid so the cached instance is returned
+    ASSERT_TRUE(edited);
+    EXPECT_EQ(edited.get(), first.get());
+    EXPECT_TRUE(edited->VerifyPseudonym());
+    EXPECT_STREQ("cached@example.com", edited->BestEmail().c_str());
+}
+
 TEST_F(Test_NymData, Claims)
 {
     auto contactData = nymData_.Claims();
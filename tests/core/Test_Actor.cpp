@@ -0,0 +1,164 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "internal/network/zeromq/Context.hpp"
+#include "util/Actor.hpp"
+#include "util/Work.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals;
+
+enum class ActorJob : ot::OTZMQWorkType {
+    shutdown = ot::value(ot::WorkType::Shutdown),
+    held = ot::OT_ZMQ_INTERNAL_SIGNAL + 0,
+    immediate = ot::OT_ZMQ_INTERNAL_SIGNAL + 1,
+    init = ot::OT_ZMQ_INIT_SIGNAL,
+    statemachine = ot::OT_ZMQ_STATE_MACHINE_SIGNAL,
+};
+
+auto print(ActorJob job) noexcept -> std::string_view;
+auto print(ActorJob job) noexcept -> std::string_view
+{
+    static const auto map = ot::Map<ActorJob, std::string_view>{
+        {ActorJob::shutdown, "shutdown"sv},
+        {ActorJob::held, "held"sv},
+        {ActorJob::immediate, "immediate"sv},
+        {ActorJob::init, "init"sv},
+        {ActorJob::statemachine, "statemachine"sv},
+    };
+
+    try {
+
+        return map.at(job);
+    } catch (...) {
+
+        return "unknown"sv;
+    }
+}
+
+// Records the sequence number of every message in the order the actor
+// processes them. The first message blocks the actor until the test has
+// queued every other message.
+class TestActor final : public ot::Actor<TestActor, ActorJob>
+{
+public:
+    using Sequence = ot::UnallocatedVector<std::uint32_t>;
+
+    std::promise<void> gate_;
+    std::promise<void> done_;
+    Sequence processed_;
+
+    auto Init(std::shared_ptr<TestActor> me) noexcept -> void
+    {
+        signal_startup(me);
+    }
+    auto Send(
+        const ActorJob job,
+        const std::uint32_t key,
+        const std::uint32_t sequence) noexcept -> void
+    {
+        auto message = ot::MakeWork(job);
+        message.AddFrame(key);
+        message.AddFrame(sequence);
+        pipeline_.Push(std::move(message));
+    }
+    auto Shutdown() noexcept -> void { signal_shutdown(); }
+
+    TestActor(
+        const ot::api::Session& api,
+        const ot::network::zeromq::BatchID batch,
+        const std::uint32_t last) noexcept
+        : Actor(
+              api,
+              ot::LogTrace(),
+              "test actor",
+              0ms,
+              batch,
+              allocator_type{
+                  api.Network().ZeroMQ().Internal().Alloc(batch)},
+              {},
+              {},
+              {},
+              {},
+              {},
+              {
+                  {ActorJob::held, {ot::CoalesceMode::latest, 1u}},
+              })
+        , gate_()
+        , done_()
+        , processed_()
+        , gate_future_(gate_.get_future())
+        , last_(last)
+    {
+    }
+
+    ~TestActor() final = default;
+
+private:
+    friend ot::Actor<TestActor, ActorJob>;
+
+    std::future<void> gate_future_;
+    const std::uint32_t last_;
+
+    auto do_shutdown() noexcept -> void {}
+    auto do_startup() noexcept -> void {}
+    auto pipeline(const Work, Message&& msg) noexcept -> void
+    {
+        const auto body = msg.Body();
+        const auto sequence = body.at(2).as<std::uint32_t>();
+
+        if (0u == sequence) { gate_future_.wait(); }
+
+        processed_.emplace_back(sequence);
+
+        if (last_ == sequence) { done_.set_value(); }
+    }
+    auto work() noexcept -> bool { return false; }
+};
+
+TEST(Actor, coalesce_preserves_order)
+{
+    const auto& api = ot::Context().StartClientSession(0);
+    const auto batch = api.Network().ZeroMQ().Internal().PreallocateBatch();
+    constexpr auto last = std::uint32_t{8};
+    auto actor = std::make_shared<TestActor>(api, batch, last);
+    auto done = actor->done_.get_future();
+    actor->Init(actor);
+    actor->Send(ActorJob::immediate, 0, 0);
+    actor->Send(ActorJob::held, 1, 1);
+    actor->Send(ActorJob::immediate, 0, 2);
+    actor->Send(ActorJob::held, 1, 3);
+    actor->Send(ActorJob::held, 1, 4);
+    actor->Send(ActorJob::held, 2, 5);
+    actor->Send(ActorJob::immediate, 0, 6);
+    actor->Send(ActorJob::held, 1, 7);
+    actor->Send(ActorJob::immediate, 0, last);
+    actor->gate_.set_value();
+
+    ASSERT_EQ(done.wait_for(1min), std::future_status::ready);
+
+    // Held messages are processed before any later message of another type.
+    // Message 3 is replaced by message 4 since both arrived between the same
+    // pair of immediate messages and share a key.
+    const auto expected = TestActor::Sequence{0, 1, 2, 4, 5, 6, 7, 8};
+
+    EXPECT_EQ(actor->processed_, expected);
+    EXPECT_EQ(actor->Statistics().coalesced_, 1u);
+
+    actor->Shutdown();
+}
+}  // namespace ottest
@@ -778,4 +778,35 @@ TEST(Amount, modulo)
 
     ASSERT_TRUE(ulonglong_amount % ot::Amount{2} == 1);
 }
+
+TEST(Amount, promotion)
+{
+    // NOTE 2^62 whole units is the largest power of two which can be stored
+    // without the arbitrary precision backend, so these results cross the
+    // boundary in both directions
+    const auto large = ot::Amount{1ll << 62};
+    auto sum = large + large;
+
+    ASSERT_TRUE(sum == 1ull << 63);
+    ASSERT_TRUE(sum.Internal().ExtractUInt64() == 1ull << 63);
+    ASSERT_TRUE(sum - large == 1ll << 62);
+    ASSERT_TRUE(sum * 2 == ot::Amount{1ull << 63} + ot::Amount{1ull << 63});
+    ASSERT_TRUE((sum * 2) / 4 == 1ll << 62);
+    ASSERT_TRUE(-sum == ot::Amount{longlong_min});
+    ASSERT_TRUE(-(-sum) == sum);
+
+    auto total = ot::Amount{longlong_max};
+    total += ot::Amount{longlong_max};
+    total += ot::Amount{2};
+
+    ASSERT_TRUE(total == ot::Amount{ulonglong_max} + ot::Amount{1});
+
+    total -= ot::Amount{ulonglong_max};
+
+    ASSERT_TRUE(total == 1);
+    ASSERT_TRUE(ot::Amount{ulonglong_max} % ot::Amount{2} == 1);
+    ASSERT_TRUE(
+        ot::Amount{ulonglong_max} * ot::Amount{ulonglong_max} / 3u ==
+        ot::Amount{ulonglong_max} * ot::Amount{ulonglong_max / 3u});
+}
 }  // namespace ottest
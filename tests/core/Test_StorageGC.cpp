@@ -0,0 +1,277 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "serialization/protobuf/StorageItemHash.pb.h"
+#include "serialization/protobuf/StorageItems.pb.h"
+#include "serialization/protobuf/StorageNym.pb.h"
+#include "serialization/protobuf/StorageNymList.pb.h"
+#include "serialization/protobuf/StorageRoot.pb.h"
+#include "util/storage/Plugin.hpp"
+#include "util/storage/tree/Root.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals;
+
+// Keeps every object in memory and records the keys it is asked to migrate
+class MemoryDriver final : public ot::storage::Driver
+{
+public:
+    using Keys = ot::UnallocatedVector<ot::UnallocatedCString>;
+
+    // Called before each object is migrated
+    std::function<void(const ot::UnallocatedCString&)> on_migrate_;
+
+    auto Contains(const ot::UnallocatedCString& key) const -> bool
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return 0u < data_.count(key);
+    }
+    auto Migrated() const -> Keys
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return migrated_;
+    }
+
+    auto EmptyBucket(const bool) const -> bool final { return true; }
+    auto Load(
+        const ot::UnallocatedCString& key,
+        const bool,
+        ot::UnallocatedCString& value) const -> bool final
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        if (auto it = data_.find(key); data_.end() != it) {
+            value = it->second;
+
+            return true;
+        }
+
+        return false;
+    }
+    auto LoadFromBucket(
+        const ot::UnallocatedCString& key,
+        ot::UnallocatedCString& value,
+        const bool) const -> bool final
+    {
+        return Load(key, false, value);
+    }
+    auto Store(
+        const bool,
+        const ot::UnallocatedCString& key,
+        const ot::UnallocatedCString& value,
+        const bool) const -> bool final
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+        data_[key] = value;
+
+        return true;
+    }
+    void Store(
+        const bool isTransaction,
+        const ot::UnallocatedCString& key,
+        const ot::UnallocatedCString& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final
+    {
+        promise.set_value(Store(isTransaction, key, value, bucket));
+    }
+    auto Store(
+        const bool isTransaction,
+        const ot::UnallocatedCString& value,
+        ot::UnallocatedCString& key) const -> bool final
+    {
+        key = std::to_string(++counter_);
+        key.insert(0, 32u - key.size(), '0');
+
+        return Store(isTransaction, key, value, false);
+    }
+    auto Migrate(
+        const ot::UnallocatedCString& key,
+        const ot::storage::Driver& to) const -> bool final
+    {
+        if (on_migrate_) { on_migrate_(key); }
+
+        auto value = ot::UnallocatedCString{};
+
+        if (false == Load(key, false, value)) { return false; }
+
+        {
+            auto lock = std::lock_guard<std::mutex>{lock_};
+            migrated_.emplace_back(key);
+        }
+
+        return to.Store(true, key, value, false);
+    }
+    auto LoadRoot() const -> ot::UnallocatedCString final { return {}; }
+    auto StoreRoot(const bool, const ot::UnallocatedCString&) const
+        -> bool final
+    {
+        return true;
+    }
+
+    MemoryDriver()
+        : on_migrate_()
+        , lock_()
+        , counter_(0)
+        , data_()
+        , migrated_()
+    {
+    }
+
+    ~MemoryDriver() final = default;
+
+private:
+    mutable std::mutex lock_;
+    mutable std::size_t counter_;
+    mutable ot::UnallocatedMap<ot::UnallocatedCString, ot::UnallocatedCString>
+        data_;
+    mutable Keys migrated_;
+};
+
+class StorageGC : public ::testing::Test
+{
+public:
+    using GC = ot::storage::Root::GC;
+
+    static constexpr auto nym_count_ = std::size_t{20};
+
+    const ot::api::session::Client& api_;
+    MemoryDriver from_;
+    MemoryDriver to_;
+    // The hashes of the nym objects, in nym id order
+    MemoryDriver::Keys nyms_;
+    ot::UnallocatedCString list_;
+    ot::UnallocatedCString root_;
+
+    StorageGC()
+        : api_(ot::Context().StartClientSession(0))
+        , from_()
+        , to_()
+        , nyms_()
+        , list_()
+        , root_()
+    {
+        auto list = ot::proto::StorageNymList{};
+        list.set_version(1);
+
+        for (auto i = std::size_t{0}; i < nym_count_; ++i) {
+            auto id = std::to_string(i);
+            id.insert(0, 24u - id.size(), '0');
+            auto nym = ot::proto::StorageNym{};
+            nym.set_version(1);
+            nym.set_nymid(id);
+            auto& hash = nyms_.emplace_back();
+
+            EXPECT_TRUE(from_.StoreProto(nym, hash));
+
+            auto& item = *list.add_nym();
+            item.set_version(1);
+            item.set_itemid(id);
+            item.set_hash(hash);
+            item.set_alias("");
+        }
+
+        EXPECT_TRUE(from_.StoreProto(list, list_));
+
+        auto items = ot::proto::StorageItems{};
+        items.set_version(1);
+        items.set_nyms(list_);
+
+        EXPECT_TRUE(from_.StoreProto(items, root_));
+
+        // NOTE each nym takes long enough to copy that a slice can not
+        // migrate all of them
+        from_.on_migrate_ = [this](const auto& key) {
+            if (nyms_.end() != std::find(nyms_.begin(), nyms_.end(), key)) {
+                std::this_thread::sleep_for(40ms);
+            }
+        };
+    }
+};
+
+TEST_F(StorageGC, resume_interrupted_collection)
+{
+    const auto& asio = api_.Network().Asio();
+    auto saved = ot::proto::StorageRoot{};
+
+    {
+        auto gc = GC{asio, api_.Factory(), from_, 1};
+        gc.Init({}, false, 0u, 0u);
+
+        ASSERT_EQ(gc.Check(root_), GC::CheckState::Start);
+
+        auto slice = std::promise<void>{};
+        auto sliceDone = slice.get_future();
+        auto once = std::atomic_flag{};
+        once.clear();
+
+        EXPECT_TRUE(gc.Run(false, to_, [&] {
+            if (false == once.test_and_set()) { slice.set_value(); }
+        }));
+
+        // Stop the collection after its first time slice as if the session
+        // had been shut down, then save the root object
+        ASSERT_EQ(sliceDone.wait_for(30s), std::future_status::ready);
+
+        gc.Cleanup();
+        gc.Serialize(saved);
+    }
+
+    const auto migrated = from_.Migrated();
+
+    EXPECT_TRUE(saved.gc());
+    EXPECT_EQ(saved.gcroot(), root_);
+    EXPECT_GT(saved.gcstep(), 0u);
+    EXPECT_LT(migrated.size(), nym_count_);
+    EXPECT_FALSE(to_.Contains(root_));
+
+    {
+        auto gc = GC{asio, api_.Factory(), from_, 1};
+        gc.Init(saved.gcroot(), saved.gc(), saved.lastgc(), saved.gcstep());
+
+        ASSERT_EQ(gc.Check(root_), GC::CheckState::Resume);
+
+        auto finished = std::promise<void>{};
+        auto done = finished.get_future();
+
+        EXPECT_TRUE(gc.Run(false, to_, [&] {
+            auto root = ot::proto::StorageRoot{};
+            gc.Serialize(root);
+
+            if (false == root.gc()) { finished.set_value(); }
+        }));
+
+        ASSERT_EQ(done.wait_for(60s), std::future_status::ready);
+    }
+
+    // Every step ran exactly once across both collections, in the same
+    // order, so the resumed collection continued where the first one stopped
+    auto expected = nyms_;
+    expected.emplace_back(list_);
+    expected.emplace_back(root_);
+
+    EXPECT_EQ(from_.Migrated(), expected);
+
+    for (const auto& key : expected) { EXPECT_TRUE(to_.Contains(key)); }
+}
+}  // namespace ottest
@@ -56,6 +56,36 @@ TEST(Message, AddFrame_string)
     ASSERT_STREQ("testString", messageString.c_str());
 }
 
+TEST(Message, AddFrame_Space)
+{
+    auto multipartMessage = ot::network::zeromq::Message{};
+    const auto small = ot::space(ot::UnallocatedCString(16, 'a'));
+    const auto large = ot::space(ot::UnallocatedCString(4096, 'b'));
+
+    auto& first = multipartMessage.AddFrame(ot::Space{small});
+    auto& second = multipartMessage.AddFrame(ot::Space{large});
+    ASSERT_EQ(multipartMessage.size(), 2);
+    EXPECT_EQ(first.Bytes(), ot::reader(small));
+    EXPECT_EQ(second.Bytes(), ot::reader(large));
+}
+
+TEST(Message, AddFrame_shared)
+{
+    auto original = ot::network::zeromq::Message{};
+    const auto& frame =
+        original.AddFrame(ot::space(ot::UnallocatedCString(4096, 'c')));
+    auto copy = ot::network::zeromq::Message{};
+    auto& shared = copy.AddFrame(frame);
+
+    ASSERT_EQ(copy.size(), 1);
+    EXPECT_EQ(shared.size(), frame.size());
+    EXPECT_EQ(shared.Bytes(), frame.Bytes());
+
+    original = ot::network::zeromq::Message{};
+
+    EXPECT_EQ(shared.Bytes(), ot::UnallocatedCString(4096, 'c'));
+}
+
 TEST(Message, at)
 {
     auto multipartMessage = ot::network::zeromq::Message{};
@@ -0,0 +1,210 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "internal/api/session/FactoryAPI.hpp"
+#include "internal/otx/common/cron/OTCron.hpp"
+#include "internal/otx/common/trade/OTMarket.hpp"
+#include "internal/otx/common/trade/OTOffer.hpp"
+#include "otx/common/OTStorage.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Market : public ::testing::Test
+{
+public:
+    using Book = ot::UnallocatedVector<std::int64_t>;
+
+    const ot::api::session::Notary& api_;
+    ot::OTPasswordPrompt reason_;
+    const ot::OTUnitID instrument_;
+    const ot::OTUnitID currency_;
+    std::unique_ptr<ot::OTCron> cron_;
+    std::unique_ptr<ot::OTMarket> market_;
+
+    auto add(
+        const bool selling,
+        const std::int64_t price,
+        const std::int64_t number) -> bool
+    {
+        auto offer = api_.Factory().InternalSession().Offer(
+            api_.ID(), instrument_, currency_, 1);
+
+        EXPECT_TRUE(offer);
+        EXPECT_TRUE(offer->MakeOffer(selling, price, 10, 1, number));
+
+        if (market_->AddOffer(nullptr, *offer, reason_, false)) {
+            offer.release();
+
+            return true;
+        }
+
+        return false;
+    }
+    // Returns the transaction numbers of the bids and the asks in the order
+    // the market lists them
+    auto book() const -> std::pair<Book, Book>
+    {
+        auto out = std::pair<Book, Book>{};
+        auto armored = ot::Armored::Factory();
+        auto count = std::int32_t{};
+
+        EXPECT_TRUE(market_->GetOfferList(armored, 0, count));
+
+        if (0 == count) { return out; }
+
+        const auto data = ot::Data::Factory(armored);
+        auto* packer = ot::OTDB::GetDefaultStorage()->GetPacker();
+        auto buffer =
+            std::unique_ptr<ot::OTDB::PackedBuffer>{packer->CreateBuffer()};
+        buffer->SetData(
+            static_cast<const std::uint8_t*>(data->data()), data->size());
+        auto list = std::unique_ptr<ot::OTDB::OfferListMarket>{
+            dynamic_cast<ot::OTDB::OfferListMarket*>(ot::OTDB::CreateObject(
+                ot::OTDB::STORED_OBJ_OFFER_LIST_MARKET))};
+
+        EXPECT_TRUE(packer->Unpack(*buffer, *list));
+
+        for (auto i = std::size_t{0}; i < list->GetBidDataCount(); ++i) {
+            out.first.emplace_back(
+                std::stoll(list->GetBidData(i)->transaction_id));
+        }
+
+        for (auto i = std::size_t{0}; i < list->GetAskDataCount(); ++i) {
+            out.second.emplace_back(
+                std::stoll(list->GetAskData(i)->transaction_id));
+        }
+
+        return out;
+    }
+
+    Market()
+        : api_(ot::Context().StartNotarySession(0))
+        , reason_(api_.Factory().PasswordPrompt(__func__))
+        , instrument_([] {
+            auto out = ot::identifier::UnitDefinition::Factory();
+            out->Randomize();
+
+            return out;
+        }())
+        , currency_([] {
+            auto out = ot::identifier::UnitDefinition::Factory();
+            out->Randomize();
+
+            return out;
+        }())
+        , cron_(api_.Factory().InternalSession().Cron())
+        , market_(api_.Factory().InternalSession().Market(
+              api_.ID(),
+              instrument_,
+              currency_,
+              1))
+    {
+        cron_->SetServerNym(api_.Wallet().Nym(api_.NymID()));
+        market_->SetCronPointer(*cron_);
+        // bids
+        add(false, 10, 1);
+        add(false, 12, 2);
+        add(false, 10, 3);
+        // asks, including a market order
+        add(true, 20, 4);
+        add(true, 15, 5);
+        add(true, 20, 6);
+        add(true, 0, 7);
+    }
+};
+
+TEST_F(Market, insert)
+{
+    EXPECT_EQ(market_->GetBidCount(), 3u);
+    EXPECT_EQ(market_->GetAskCount(), 4u);
+    EXPECT_EQ(market_->GetHighestBidPrice(), 12);
+    EXPECT_EQ(market_->GetLowestAskPrice(), 15);
+
+    for (auto number = std::int64_t{1}; number < 8; ++number) {
+        const auto* offer = market_->GetOffer(number);
+
+        ASSERT_NE(offer, nullptr);
+        EXPECT_EQ(offer->GetTransactionNum(), number);
+    }
+
+    EXPECT_EQ(market_->GetOffer(8), nullptr);
+    EXPECT_FALSE(add(false, 11, 1));
+    EXPECT_FALSE(add(true, 11, 4));
+    EXPECT_EQ(market_->GetBidCount(), 3u);
+    EXPECT_EQ(market_->GetAskCount(), 4u);
+}
+
+TEST_F(Market, remove)
+{
+    // Remove an offer from the middle of a price level
+    EXPECT_TRUE(market_->RemoveOffer(4, reason_));
+    EXPECT_EQ(market_->GetOffer(4), nullptr);
+    EXPECT_EQ(market_->GetAskCount(), 3u);
+    EXPECT_EQ(market_->GetLowestAskPrice(), 15);
+    EXPECT_EQ(book().second, Book({7, 5, 6}));
+
+    // Remove the top of each side
+    EXPECT_TRUE(market_->RemoveOffer(5, reason_));
+    EXPECT_TRUE(market_->RemoveOffer(2, reason_));
+    EXPECT_EQ(market_->GetLowestAskPrice(), 20);
+    EXPECT_EQ(market_->GetHighestBidPrice(), 10);
+    EXPECT_EQ(book(), std::make_pair(Book({3, 1}), Book({7, 6})));
+
+    EXPECT_FALSE(market_->RemoveOffer(2, reason_));
+    EXPECT_EQ(market_->GetBidCount(), 2u);
+
+    // A transaction number may be reused once its offer is gone
+    EXPECT_TRUE(add(false, 12, 2));
+    EXPECT_EQ(market_->GetHighestBidPrice(), 12);
+}
+
+TEST_F(Market, match_order)
+{
+    // Bids are matched from the back of the list: highest price first, and
+    // the oldest offer first within a price level. Asks are matched from the
+    // front: lowest price first, oldest first, with market orders in front of
+    // every limit order.
+    const auto [bids, asks] = book();
+
+    EXPECT_EQ(bids, Book({3, 1, 2}));
+    EXPECT_EQ(asks, Book({7, 5, 4, 6}));
+
+    EXPECT_TRUE(market_->RemoveOffer(1, reason_));
+    EXPECT_TRUE(add(false, 10, 8));
+    EXPECT_TRUE(add(true, 15, 9));
+    EXPECT_EQ(book(), std::make_pair(Book({8, 3, 2}), Book({7, 5, 9, 4, 6})));
+}
+
+TEST_F(Market, market_order_asks)
+{
+    // Market order asks do not affect the lowest ask price, and are listed
+    // in front of the priced asks in the order they were added
+    EXPECT_TRUE(add(true, 0, 8));
+    EXPECT_TRUE(add(true, 0, 9));
+    EXPECT_EQ(market_->GetAskCount(), 6u);
+    EXPECT_EQ(market_->GetLowestAskPrice(), 15);
+    EXPECT_EQ(book().second, Book({7, 8, 9, 5, 4, 6}));
+
+    EXPECT_TRUE(market_->RemoveOffer(8, reason_));
+    EXPECT_EQ(market_->GetOffer(8), nullptr);
+    EXPECT_EQ(book().second, Book({7, 9, 5, 4, 6}));
+
+    EXPECT_TRUE(market_->RemoveOffer(4, reason_));
+    EXPECT_TRUE(market_->RemoveOffer(5, reason_));
+    EXPECT_TRUE(market_->RemoveOffer(6, reason_));
+    EXPECT_EQ(market_->GetLowestAskPrice(), 0);
+    EXPECT_EQ(market_->GetAskCount(), 2u);
+    EXPECT_EQ(book().second, Book({7, 9}));
+}
+}  // namespace ottest
@@ -9,11 +9,15 @@
 #include <functional>
 #include <iosfwd>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "interface/ui/base/Items.hpp"
 #include "internal/interface/ui/UI.hpp"
+#include "internal/util/Mutex.hpp"
 
 namespace ot = opentxs;
 
@@ -370,7 +374,7 @@ TEST(UI_items, move_up)
         EXPECT_EQ(prev, nullptr);
     }
 
-    items_.move_before(oldID, before.first, newKey, newID, after.first);
+    items_.move_before(before.first, newKey, newID);
     const auto active = Active{
         revised_.at(0).id_,
         vector_.at(0).id_,
@@ -415,7 +419,7 @@ TEST(UI_items, move_down)
         EXPECT_EQ(prev, items_.at(3).item_.get());
     }
 
-    items_.move_before(oldID, before.first, newKey, newID, after.first);
+    items_.move_before(before.first, newKey, newID);
     const auto active = Active{
         revised_.at(0).id_,
         vector_.at(0).id_,
@@ -563,4 +567,243 @@ TEST(UI_items, reverse_sort)
     EXPECT_TRUE(test_row(items, 4, vector_.at(1)));
     EXPECT_TRUE(test_row(items, 5, vector_.at(0)));
 }
+TEST(UI_items, ranked_index)
+{
+    constexpr auto offset = std::size_t{2};
+    constexpr auto count = ID{100};
+    constexpr auto size = static_cast<std::size_t>(count);
+    const auto position = [&](const ID id) {
+        return offset + static_cast<std::size_t>(id);
+    };
+    const auto key = [](const ID id) {
+        auto out = std::to_string(id);
+        out.insert(0, 3u - out.size(), '0');
+
+        return out;
+    };
+    auto items = Type{offset, false};
+
+    // Insert out of order so most insertions land in the middle of the tree
+    for (auto i = ID{0}; i < count; ++i) {
+        const auto id = (i * 37) % count;
+        const auto [it, prev] = items.find_insert_position(key(id), id);
+        items.insert_before(it, key(id), id, std::make_shared<Value>("row"));
+    }
+
+    ASSERT_EQ(items.size(), size);
+
+    for (auto id = ID{0}; id < count; ++id) {
+        const auto index = items.get_index(id);
+
+        ASSERT_TRUE(index);
+        EXPECT_EQ(index.value(), position(id));
+        EXPECT_EQ(items.at(position(id)).id_, id);
+        EXPECT_EQ(items.at(position(id)).key_, key(id));
+    }
+
+    EXPECT_THROW(items.at(0), std::out_of_range);
+    EXPECT_THROW(items.at(offset - 1u), std::out_of_range);
+    EXPECT_THROW(items.at(offset + size), std::out_of_range);
+    EXPECT_FALSE(items.get_index(count));
+
+    // Every row after a deleted row shifts up by one position
+    for (auto id = ID{0}; id < count; id += 2) {
+        const auto row = items.find_delete_position(id);
+
+        ASSERT_TRUE(row);
+        EXPECT_EQ(row.value().second, position(id / 2));
+
+        items.delete_row(id, row.value().first);
+    }
+
+    ASSERT_EQ(items.size(), size / 2u);
+
+    for (auto id = ID{1}; id < count; id += 2) {
+        const auto index = items.get_index(id);
+
+        ASSERT_TRUE(index);
+        EXPECT_EQ(index.value(), position(id / 2));
+        EXPECT_EQ(items.at(position(id / 2)).id_, id);
+        EXPECT_FALSE(items.get_index(id - 1));
+    }
+
+    // Moving a row to the front shifts every row it passes down by one
+    const auto last = count - 1;
+    const auto move = items.find_move_position(last, key(0), last);
+
+    ASSERT_TRUE(move);
+
+    items.move_before(move.value().first.first, key(0), last);
+
+    ASSERT_TRUE(items.get_index(last));
+    ASSERT_TRUE(items.get_index(1));
+    ASSERT_TRUE(items.get_index(last - 2));
+    EXPECT_EQ(items.get_index(last).value(), offset);
+    EXPECT_EQ(items.at(offset).id_, last);
+    EXPECT_EQ(items.get_index(1).value(), offset + 1u);
+    EXPECT_EQ(items.get_index(last - 2).value(), offset + (size / 2u) - 1u);
+    EXPECT_THROW(items.at(offset + (size / 2u)), std::out_of_range);
+}
+
+TEST(UI_items, snapshot_batch)
+{
+    using Snapshot =
+        ot::ui::implementation::ListSnapshot<ID, Key, std::shared_ptr<Value>>;
+    auto mutex = std::recursive_mutex{};
+    auto items = Type{0, false};
+    auto snapshot = Snapshot{};
+    const auto insert = [&](const Data& row) {
+        const auto& [key, id, value] = row;
+        const auto [it, prev] = items.find_insert_position(key, id);
+        items.insert_before(it, key, id, std::make_shared<Value>(value));
+        snapshot.Changed();
+    };
+    const auto batch = [&](const auto& cb) {
+        auto lock = ot::rLock{mutex};
+
+        EXPECT_TRUE(snapshot.Begin());
+
+        cb();
+
+        EXPECT_TRUE(snapshot.End());
+    };
+    const auto initial = snapshot.Get(mutex, items);
+
+    ASSERT_TRUE(initial);
+    EXPECT_TRUE(initial->rows_.empty());
+    EXPECT_FALSE(initial->last_.has_value());
+
+    batch([&] {
+        insert(vector_.at(1));
+
+        EXPECT_FALSE(snapshot.Begin());
+
+        insert(vector_.at(0));
+
+        EXPECT_FALSE(snapshot.End());
+        // NOTE rows changed by an open batch are not visible until the
+        // outermost batch ends
+        EXPECT_EQ(snapshot.Get(mutex, items), initial);
+    });
+
+    const auto first = snapshot.Get(mutex, items);
+
+    ASSERT_TRUE(first);
+    ASSERT_EQ(first->rows_.size(), 2u);
+    EXPECT_EQ(*first->rows_.at(0), vector_.at(0).value_);
+    EXPECT_EQ(*first->rows_.at(1), vector_.at(1).value_);
+    EXPECT_EQ(first->ids_, (Active{vector_.at(0).id_, vector_.at(1).id_}));
+    EXPECT_EQ(first->last_, vector_.at(1).id_);
+    EXPECT_EQ(snapshot.Get(mutex, items), first);
+
+    // A batch which changes nothing keeps the existing snapshot
+    batch([] {});
+
+    EXPECT_EQ(snapshot.Get(mutex, items), first);
+
+    // Several batches which are not read in between are copied once
+    batch([&] { insert(vector_.at(3)); });
+    batch([&] { insert(vector_.at(2)); });
+
+    const auto second = snapshot.Get(mutex, items);
+
+    ASSERT_TRUE(second);
+    ASSERT_EQ(second->rows_.size(), 4u);
+    EXPECT_EQ(*second->rows_.at(2), vector_.at(2).value_);
+    EXPECT_EQ(*second->rows_.at(3), vector_.at(3).value_);
+    EXPECT_EQ(second->last_, vector_.at(3).id_);
+    EXPECT_EQ(snapshot.Get(mutex, items), second);
+    EXPECT_EQ(first->rows_.size(), 2u);
+}
+
+TEST(UI_items, contiguous_runs)
+{
+    using Runs = ot::UnallocatedVector<std::pair<int, int>>;
+    using ot::ui::qt::internal::ContiguousRuns;
+
+    EXPECT_EQ(ContiguousRuns({}), Runs{});
+    EXPECT_EQ(ContiguousRuns({5}), (Runs{{5, 5}}));
+    EXPECT_EQ((ContiguousRuns({2, 1, 2})), (Runs{{1, 2}}));
+    EXPECT_EQ(
+        (ContiguousRuns({3, 0, 7, 1, 4, 9, 8, 2})), (Runs{{7, 9}, {0, 4}}));
+    EXPECT_EQ((ContiguousRuns({0, 2, 4})), (Runs{{4, 4}, {2, 2}, {0, 0}}));
+}
+
+TEST(UI_items, row_queue)
+{
+    using Queue = ot::ui::qt::internal::RowQueue;
+    using Op = Queue::Op;
+    using Pointers = ot::UnallocatedVector<ot::ui::internal::Row*>;
+    auto parent = Value{"parent"};
+    auto rows = ot::UnallocatedVector<std::shared_ptr<Value>>{};
+
+    for (auto i = 0; i < 5; ++i) {
+        rows.emplace_back(std::make_shared<Value>("row"));
+    }
+
+    const auto row = [&](const std::size_t i) -> ot::ui::internal::Row* {
+        return rows.at(i).get();
+    };
+    const auto inserted = [](const Queue::Operation& op) {
+        auto out = Pointers{};
+
+        for (const auto& pointer : op.inserted_) {
+            out.emplace_back(pointer.get());
+        }
+
+        return out;
+    };
+    auto queue = Queue{};
+
+    EXPECT_TRUE(queue.empty());
+
+    // NOTE rows inserted after the last row of the range, or after the row
+    // which the range follows, extend the range
+    queue.Insert(&parent, nullptr, rows.at(1));
+    queue.Insert(&parent, row(1), rows.at(2));
+    queue.Insert(&parent, nullptr, rows.at(0));
+    queue.Insert(&parent, row(2), rows.at(3));
+    queue.Change(&parent, row(1));
+    queue.Change(&parent, row(1));
+    queue.Insert(row(0), nullptr, rows.at(4));
+    queue.Delete(row(3));
+    queue.Delete(row(2));
+    queue.Move(&parent, nullptr, row(1));
+    queue.Delete(row(0));
+
+    EXPECT_FALSE(queue.empty());
+
+    const auto ops = queue.Take();
+
+    EXPECT_TRUE(queue.empty());
+    ASSERT_EQ(ops.size(), 6u);
+
+    EXPECT_EQ(ops.at(0).type_, Op::insert);
+    EXPECT_EQ(ops.at(0).parent_, &parent);
+    EXPECT_EQ(ops.at(0).after_, nullptr);
+    EXPECT_EQ(inserted(ops.at(0)), (Pointers{row(0), row(1), row(2), row(3)}));
+
+    EXPECT_EQ(ops.at(1).type_, Op::change);
+    EXPECT_EQ(ops.at(1).rows_, Pointers{row(1)});
+
+    EXPECT_EQ(ops.at(2).type_, Op::insert);
+    EXPECT_EQ(ops.at(2).parent_, row(0));
+    EXPECT_EQ(inserted(ops.at(2)), Pointers{row(4)});
+
+    EXPECT_EQ(ops.at(3).type_, Op::remove);
+    EXPECT_EQ(ops.at(3).rows_, (Pointers{row(3), row(2)}));
+
+    EXPECT_EQ(ops.at(4).type_, Op::move);
+    EXPECT_EQ(ops.at(4).parent_, &parent);
+    EXPECT_EQ(ops.at(4).after_, nullptr);
+    EXPECT_EQ(ops.at(4).rows_, Pointers{row(1)});
+
+    EXPECT_EQ(ops.at(5).type_, Op::remove);
+    EXPECT_EQ(ops.at(5).rows_, Pointers{row(0)});
+
+    // A row which was changed in a previous batch is reported again
+    queue.Change(&parent, row(1));
+
+    ASSERT_EQ(queue.Take().size(), 1u);
+}
 }  // namespace ottest